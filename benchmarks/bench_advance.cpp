@@ -0,0 +1,160 @@
+#include "datelib/CompiledCalendar.h"
+#include "datelib/HolidayCalendar.h"
+#include "datelib/JointCalendar.h"
+#include "datelib/TenorCache.h"
+#include "datelib/date.h"
+#include "datelib/period.h"
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::chrono;
+
+namespace {
+datelib::HolidayCalendar makeUsCalendar() {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Martin Luther King Jr. Day", 1, 1,
+                                                               datelib::Occurrence::Third));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Presidents Day", 2, 1,
+                                                               datelib::Occurrence::Third));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Memorial Day", 5, 1,
+                                                               datelib::Occurrence::Last));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Independence Day", 7, 4));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Labor Day", 9, 1,
+                                                               datelib::Occurrence::First));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Thanksgiving", 11, 4,
+                                                               datelib::Occurrence::Fourth));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    return calendar;
+}
+
+datelib::HolidayCalendar makeUkCalendar() {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::EasterRule>("Good Friday", -2));
+    calendar.addRule(std::make_unique<datelib::EasterRule>("Easter Monday", 1));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Early May Bank Holiday", 5, 1,
+                                                               datelib::Occurrence::First));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Spring Bank Holiday", 5, 1,
+                                                               datelib::Occurrence::Last));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Summer Bank Holiday", 8, 1,
+                                                               datelib::Occurrence::Last));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Boxing Day", 12, 26));
+    return calendar;
+}
+
+// Typical pillars of a swap curve
+std::vector<datelib::Period> makeCurveGrid() {
+    std::vector<datelib::Period> grid;
+    for (const auto* tenor : {"1D",  "2D",  "1W",  "2W",  "3W",  "1M",  "2M",  "3M",  "4M",
+                              "5M",  "6M",  "7M",  "8M",  "9M",  "10M", "11M", "12M", "15M",
+                              "18M", "21M", "2Y",  "3Y",  "4Y",  "5Y",  "6Y",  "7Y",  "8Y",
+                              "9Y",  "10Y", "11Y", "12Y", "15Y", "20Y", "25Y", "30Y", "40Y",
+                              "50Y"}) {
+        grid.push_back(datelib::Period::parse(tenor));
+    }
+    return grid;
+}
+} // namespace
+
+TEST_CASE("Tenor grid advance", "[benchmark][advance]") {
+    const datelib::HolidayCalendar calendar = makeUsCalendar();
+    const std::vector<datelib::Period> grid = makeCurveGrid();
+    const year_month_day spot = 2024y / January / 31;
+    constexpr auto convention = datelib::BusinessDayConvention::ModifiedFollowing;
+
+    // Warm the calendar's year cache so that both variants start from the same state
+    (void)datelib::advance(spot, grid, convention, calendar);
+
+    const auto compiled = calendar.compile(2020, 2080);
+    std::vector<year_month_day> pillars(grid.size());
+
+    BENCHMARK("scalar advance per pillar") {
+        std::vector<year_month_day> result;
+        result.reserve(grid.size());
+        for (const auto& period : grid) {
+            result.push_back(datelib::advance(spot, period, convention, calendar));
+        }
+        return result;
+    };
+
+    BENCHMARK("batch advance") {
+        return datelib::advance(spot, grid, convention, calendar);
+    };
+
+    BENCHMARK("batch advance on a precompiled calendar") {
+        compiled.advance(spot, grid, pillars, convention);
+        return pillars.back();
+    };
+}
+
+TEST_CASE("Tenor string resolution", "[benchmark][period]") {
+    // A feed of common tenors in an irregular order, as they arrive from market data
+    constexpr std::string_view tenors[] = {"1M", "3M", "6M", "1Y", "2Y", "5Y", "10Y", "1W"};
+    std::vector<std::string_view> feed;
+    for (std::size_t i = 0; i < 1024; ++i) {
+        feed.push_back(tenors[(i * 7 + i / 8) % std::size(tenors)]);
+    }
+    datelib::TenorCache cache;
+
+    BENCHMARK("Period::parse") {
+        int total = 0;
+        for (const auto tenor : feed) {
+            total += datelib::Period::parse(tenor).value();
+        }
+        return total;
+    };
+
+    BENCHMARK("TenorCache::resolve") {
+        int total = 0;
+        for (const auto tenor : feed) {
+            total += cache.resolve(tenor).value();
+        }
+        return total;
+    };
+}
+
+TEST_CASE("Joint calendar adjust", "[benchmark][JointCalendar]") {
+    const datelib::HolidayCalendar new_york = makeUsCalendar();
+    const datelib::HolidayCalendar london = makeUkCalendar();
+    const datelib::JointCalendar joint({new_york, london});
+    constexpr auto convention = datelib::BusinessDayConvention::ModifiedFollowing;
+
+    // The former workaround: every rule of both calendars copied into one calendar
+    datelib::HolidayCalendar merged = makeUsCalendar();
+    const datelib::HolidayCalendar uk = makeUkCalendar();
+    for (int year = 2024; year <= 2025; ++year) {
+        for (const auto& date : uk.getHolidays(year)) {
+            merged.addHoliday("UK holiday", date);
+        }
+    }
+
+    // Every day of a year, so that most adjustments cross a weekend or a holiday
+    std::vector<year_month_day> dates;
+    for (sys_days day = sys_days{2024y / January / 1}; day < sys_days{2025y / January / 1};
+         day += days{1}) {
+        dates.emplace_back(day);
+    }
+
+    BENCHMARK("adjust on a merged calendar") {
+        int total = 0;
+        for (const auto& date : dates) {
+            total += static_cast<int>(unsigned{datelib::adjust(date, convention, merged).day()});
+        }
+        return total;
+    };
+
+    BENCHMARK("adjust on a joint calendar") {
+        int total = 0;
+        for (const auto& date : dates) {
+            total += static_cast<int>(unsigned{joint.adjust(date, convention).day()});
+        }
+        return total;
+    };
+}
@@ -0,0 +1,87 @@
+#include "bench_calendars.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std::chrono;
+
+namespace bench {
+
+namespace {
+constexpr int EXCHANGE_FIRST_YEAR = 1900;
+constexpr int EXCHANGE_LAST_YEAR = 2199;
+constexpr int CLOSINGS_PER_YEAR = 10;
+constexpr int LARGE_CALENDAR_RULES = 200;
+} // namespace
+
+datelib::HolidayCalendar makeCountryCalendar() {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Epiphany", 1, 6));
+    calendar.addRule(std::make_unique<datelib::EasterRule>("Good Friday", -2));
+    calendar.addRule(std::make_unique<datelib::EasterRule>("Easter Monday", 1));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Labour Day", 5, 1));
+    calendar.addRule(std::make_unique<datelib::EasterRule>("Ascension Day", 39));
+    calendar.addRule(std::make_unique<datelib::EasterRule>("Whit Monday", 50));
+    calendar.addRule(std::make_unique<datelib::EasterRule>("Corpus Christi", 60));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Spring Holiday", 5, 1,
+                                                               datelib::Occurrence::Last));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Assumption Day", 8, 15));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("National Day", 10, 3));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Harvest Day", 10, 1,
+                                                               datelib::Occurrence::Second));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("All Saints' Day", 11, 1));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas Day", 12, 25));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Boxing Day", 12, 26));
+    return calendar;
+}
+
+datelib::HolidayCalendar makeExchangeCalendar() {
+    std::vector<std::pair<std::string, year_month_day>> closings;
+    for (int y = EXCHANGE_FIRST_YEAR; y <= EXCHANGE_LAST_YEAR; ++y) {
+        const sys_days first_day{year{y} / January / 1};
+        // Spread the closings over the year, one in each stretch of 36 days
+        for (int k = 0; k < CLOSINGS_PER_YEAR; ++k) {
+            const int day_of_year = k * 36 + (y * 7 + k * 13) % 36;
+            closings.emplace_back("Closing", year_month_day{first_day + days{day_of_year}});
+        }
+    }
+    datelib::HolidayCalendar calendar;
+    calendar.addHolidays(closings);
+    return calendar;
+}
+
+datelib::HolidayCalendar makeLargeRuleCalendar() {
+    constexpr datelib::Occurrence occurrences[] = {
+        datelib::Occurrence::First, datelib::Occurrence::Second, datelib::Occurrence::Third,
+        datelib::Occurrence::Fourth, datelib::Occurrence::Last};
+    datelib::HolidayCalendar calendar;
+    for (int i = 0; i < LARGE_CALENDAR_RULES; ++i) {
+        const std::string name = "Rule " + std::to_string(i);
+        const auto month = static_cast<unsigned>(i % 12 + 1);
+        switch (i % 4) {
+        case 0:
+            calendar.addRule(std::make_unique<datelib::FixedDateRule>(
+                name, month, static_cast<unsigned>(i % 28 + 1)));
+            break;
+        case 1:
+            calendar.addRule(std::make_unique<datelib::NthWeekdayRule>(
+                name, month, static_cast<unsigned>(i % 5 + 1), occurrences[i % 5]));
+            break;
+        case 2:
+            calendar.addRule(std::make_unique<datelib::EasterRule>(name, i % 120 - 60));
+            break;
+        default:
+            calendar.addRule(std::make_unique<datelib::ObservedRule>(
+                name,
+                std::make_unique<datelib::FixedDateRule>(name, month,
+                                                         static_cast<unsigned>(i % 28 + 1)),
+                datelib::Observance::NearestWeekday));
+            break;
+        }
+    }
+    return calendar;
+}
+
+} // namespace bench
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "datelib/HolidayCalendar.h"
+
+namespace bench {
+
+/**
+ * @brief A national calendar of 15 rules: fixed dates, Easter offsets and weekday rules
+ */
+datelib::HolidayCalendar makeCountryCalendar();
+
+/**
+ * @brief An exchange calendar of 3000 explicit closing dates, ten a year from 1900 to 2199
+ */
+datelib::HolidayCalendar makeExchangeCalendar();
+
+/**
+ * @brief A calendar of 200 rules of every built-in kind, for the cost of evaluating rules
+ */
+datelib::HolidayCalendar makeLargeRuleCalendar();
+
+} // namespace bench
@@ -0,0 +1,199 @@
+#include "datelib/HolidayCalendar.h"
+#include "datelib/date.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <iostream>
+#include <latch>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::chrono;
+
+namespace {
+// Lookups made by each thread per benchmark run, enough to dwarf the cost of starting threads
+constexpr int LOOKUPS_PER_THREAD = 200'000;
+
+// Timed runs per thread count in the scaling report; the fastest one is kept
+constexpr int SCALING_RUNS = 5;
+
+// Per-thread throughput, relative to one thread, below which scaling is reported as sub-linear
+constexpr double SCALING_EFFICIENCY_THRESHOLD = 0.8;
+
+datelib::HolidayCalendar makeCalendar() {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::EasterRule>("Good Friday", -2));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Memorial Day", 5, 1,
+                                                               datelib::Occurrence::Last));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Independence Day", 7, 4));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Thanksgiving", 11, 4,
+                                                               datelib::Occurrence::Fourth));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    return calendar;
+}
+
+/**
+ * @brief The date a thread looks up at step i, spreading the threads over thirty years
+ */
+datelib::BusinessDate lookupDate(const unsigned thread_index, const int i) {
+    const datelib::BusinessDate start{sys_days{2000y / January / 1}};
+    return start + static_cast<datelib::BusinessDate::rep>(
+                       (i * 37 + static_cast<int>(thread_index) * 1009) % 10950);
+}
+
+/**
+ * @brief Run lookups_per_thread calls of lookup(thread_index, i) on each of a number of threads
+ *
+ * The threads wait for each other before starting, so that thread creation is not mistaken for
+ * contention. Returns the sum of the results, so that no lookup can be optimized away.
+ */
+template <typename Lookup>
+long long runOnThreads(const unsigned thread_count, const int lookups_per_thread,
+                       const Lookup& lookup) {
+    std::atomic<long long> total{0};
+    std::latch ready(static_cast<std::ptrdiff_t>(thread_count));
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            ready.arrive_and_wait();
+            long long sum = 0;
+            for (int i = 0; i < lookups_per_thread; ++i) {
+                sum += lookup(t, i);
+            }
+            total.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return total.load();
+}
+
+/**
+ * @brief 1, 2, 4, ... threads up to the hardware concurrency, which is always included
+ */
+std::vector<unsigned> threadCounts() {
+    const unsigned max_threads = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<unsigned> counts;
+    for (unsigned threads = 1; threads < max_threads; threads *= 2) {
+        counts.push_back(threads);
+    }
+    counts.push_back(max_threads);
+    return counts;
+}
+
+/**
+ * @brief Print the throughput of a lookup for every thread count and flag sub-linear scaling
+ * @return The thread counts whose per-thread throughput fell below the threshold
+ */
+template <typename Lookup>
+std::vector<unsigned> reportScaling(const std::string& scenario, const Lookup& lookup) {
+    std::cout << std::format("{}\n{:>8} {:>16} {:>16} {:>11}\n", scenario, "threads", "ops/s",
+                             "ops/s/thread", "efficiency");
+    std::vector<unsigned> sub_linear;
+    double single_thread_rate = 0;
+    for (const unsigned threads : threadCounts()) {
+        auto best = duration<double>::max();
+        for (int run = 0; run < SCALING_RUNS; ++run) {
+            const auto start = steady_clock::now();
+            (void)runOnThreads(threads, LOOKUPS_PER_THREAD, lookup);
+            best = std::min(best, duration<double>(steady_clock::now() - start));
+        }
+        const double rate = threads * static_cast<double>(LOOKUPS_PER_THREAD) / best.count();
+        const double per_thread = rate / threads;
+        if (threads == 1) {
+            single_thread_rate = per_thread;
+        }
+        const double efficiency = per_thread / single_thread_rate;
+        const bool flagged = efficiency < SCALING_EFFICIENCY_THRESHOLD;
+        if (flagged) {
+            sub_linear.push_back(threads);
+        }
+        std::cout << std::format("{:>8} {:>16.0f} {:>16.0f} {:>10.0f}%{}\n", threads, rate,
+                                 per_thread, efficiency * 100, flagged ? "  SUB-LINEAR" : "");
+    }
+    return sub_linear;
+}
+} // namespace
+
+TEST_CASE("Concurrent isHoliday readers", "[benchmark][concurrency]") {
+    const datelib::HolidayCalendar calendar = makeCalendar();
+    const auto is_holiday = [&calendar](const unsigned t, const int i) {
+        return calendar.isHoliday(lookupDate(t, i)) ? 1 : 0;
+    };
+
+    // Materialize the years first; the benchmark measures the read path only
+    (void)runOnThreads(1, LOOKUPS_PER_THREAD, is_holiday);
+
+    // Each thread does the same amount of work, so with linear scaling every run takes as long
+    // as the single-threaded one
+    for (const unsigned threads : threadCounts()) {
+        BENCHMARK("isHoliday, " + std::to_string(threads) + " thread(s)") {
+            return runOnThreads(threads, LOOKUPS_PER_THREAD, is_holiday);
+        };
+    }
+}
+
+TEST_CASE("Concurrent business day readers", "[benchmark][concurrency]") {
+    const datelib::HolidayCalendar calendar = makeCalendar();
+    constexpr auto convention = datelib::BusinessDayConvention::ModifiedFollowing;
+    const auto is_business_day = [&calendar](const unsigned t, const int i) {
+        return datelib::isBusinessDay(lookupDate(t, i), calendar) ? 1 : 0;
+    };
+    const auto adjust = [&calendar](const unsigned t, const int i) {
+        return datelib::adjust(lookupDate(t, i), convention, calendar).serial();
+    };
+    (void)runOnThreads(1, LOOKUPS_PER_THREAD, adjust);
+
+    for (const unsigned threads : threadCounts()) {
+        BENCHMARK("isBusinessDay, " + std::to_string(threads) + " thread(s)") {
+            return runOnThreads(threads, LOOKUPS_PER_THREAD, is_business_day);
+        };
+        BENCHMARK("adjust, " + std::to_string(threads) + " thread(s)") {
+            return runOnThreads(threads, LOOKUPS_PER_THREAD, adjust);
+        };
+    }
+}
+
+// Hidden: run with bench_datelib "[scaling]". Throughput per thread count for readers sharing one
+// calendar, with thread counts where per-thread throughput drops below 80% of the single-threaded
+// rate flagged as SUB-LINEAR (false sharing, a lock or allocator contention on the read path)
+TEST_CASE("Calendar reader scaling", "[.][scaling]") {
+    const datelib::HolidayCalendar calendar = makeCalendar();
+    constexpr auto convention = datelib::BusinessDayConvention::ModifiedFollowing;
+    (void)runOnThreads(1, LOOKUPS_PER_THREAD, [&calendar](const unsigned t, const int i) {
+        return calendar.isHoliday(lookupDate(t, i)) ? 1 : 0;
+    });
+
+    const auto is_business_day = reportScaling(
+        "isBusinessDay", [&calendar](const unsigned t, const int i) {
+            return datelib::isBusinessDay(lookupDate(t, i), calendar) ? 1 : 0;
+        });
+    const auto adjust =
+        reportScaling("adjust ModifiedFollowing", [&calendar](const unsigned t, const int i) {
+            return datelib::adjust(lookupDate(t, i), convention, calendar).serial();
+        });
+    // Returns strings, so every lookup of a holiday goes through the allocator
+    const auto holiday_names =
+        reportScaling("getHolidayNames", [&calendar](const unsigned t, const int i) {
+            const auto date = lookupDate(t, i).toYearMonthDay();
+            return static_cast<long long>(calendar.getHolidayNames(date).size());
+        });
+
+    for (const auto& [scenario, flagged] :
+         {std::pair{"isBusinessDay", is_business_day}, std::pair{"adjust", adjust},
+          std::pair{"getHolidayNames", holiday_names}}) {
+        if (!flagged.empty()) {
+            WARN(scenario << " scales sub-linearly from " << flagged.front() << " threads");
+        }
+    }
+}
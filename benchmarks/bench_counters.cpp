@@ -0,0 +1,133 @@
+#include "bench_calendars.h"
+#include "datelib/date.h"
+#include "datelib/period.h"
+#include "perf_counters.h"
+
+#include <format>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::chrono;
+
+namespace {
+// Times each scenario runs under the counters, after one warm-up run
+constexpr int MEASURED_RUNS = 20;
+
+/**
+ * @brief Print one row of per-operation counts, "n/a" for counters that could not be recorded
+ */
+void printRow(std::string_view scenario, const bench::PerfCounters& counters, const double ops) {
+    std::string row = std::format("{:<34}", scenario);
+    for (std::size_t i = 0; i < bench::COUNTER_COUNT; ++i) {
+        const auto value = counters.value(static_cast<bench::Counter>(i));
+        row += value ? std::format(" {:>14.2f}", *value / ops) : std::format(" {:>14}", "n/a");
+    }
+    const auto cycles = counters.value(bench::Counter::Cycles);
+    const auto instructions = counters.value(bench::Counter::Instructions);
+    row += cycles && instructions && *cycles > 0 ? std::format(" {:>6.2f}", *instructions / *cycles)
+                                                 : std::format(" {:>6}", "n/a");
+    std::cout << row << '\n';
+}
+
+/**
+ * @brief Run a scenario of ops operations under the counters and print the counts per operation
+ */
+void measure(bench::PerfCounters& counters, std::string_view scenario, const int ops,
+             const std::function<int()>& run) {
+    int sink = run();
+    counters.start();
+    for (int i = 0; i < MEASURED_RUNS; ++i) {
+        sink += run();
+    }
+    counters.stop();
+    // Keep the result alive so that the scenario cannot be optimized away
+    volatile int keep = sink;
+    (void)keep;
+    printRow(scenario, counters, static_cast<double>(ops) * MEASURED_RUNS);
+}
+} // namespace
+
+// Hidden: run with bench_datelib "[perf]"
+TEST_CASE("Hardware counters per operation", "[.][perf]") {
+    bench::PerfCounters counters;
+    if (!counters.available()) {
+        WARN("Hardware counters unavailable: " << counters.unavailableReason());
+        return;
+    }
+    if (!counters.unavailableReason().empty()) {
+        WARN("Some hardware counters unavailable: " << counters.unavailableReason());
+    }
+
+    const datelib::HolidayCalendar country = bench::makeCountryCalendar();
+    const datelib::HolidayCalendar exchange = bench::makeExchangeCalendar();
+    constexpr auto convention = datelib::BusinessDayConvention::ModifiedFollowing;
+    std::vector<year_month_day> decade;
+    for (sys_days day = sys_days{2020y / January / 1}; day < sys_days{2030y / January / 1};
+         day += days{1}) {
+        decade.emplace_back(day);
+    }
+    const int decade_days = static_cast<int>(decade.size());
+
+    std::string header = std::format("{:<34}", "per operation");
+    for (std::size_t i = 0; i < bench::COUNTER_COUNT; ++i) {
+        header += std::format(" {:>14}", bench::counterName(static_cast<bench::Counter>(i)));
+    }
+    std::cout << header << std::format(" {:>6}", "IPC") << '\n';
+
+    measure(counters, "isHoliday, 15-rule calendar", decade_days, [&] {
+        int holidays = 0;
+        for (const auto& date : decade) {
+            holidays += country.isHoliday(date) ? 1 : 0;
+        }
+        return holidays;
+    });
+
+    measure(counters, "adjust, 15-rule calendar", decade_days, [&] {
+        int total = 0;
+        for (const auto& date : decade) {
+            total += static_cast<int>(unsigned{datelib::adjust(date, convention, country).day()});
+        }
+        return total;
+    });
+
+    measure(counters, "adjust, 3000-date calendar", decade_days, [&] {
+        int total = 0;
+        for (const auto& date : decade) {
+            total += static_cast<int>(unsigned{datelib::adjust(date, convention, exchange).day()});
+        }
+        return total;
+    });
+
+    measure(counters, "advance 1D-250D, 15-rule calendar", 250, [&] {
+        int total = 0;
+        for (int n = 1; n <= 250; ++n) {
+            const datelib::Period period(n, datelib::Period::Unit::Days);
+            total += static_cast<int>(
+                unsigned{datelib::advance(2024y / March / 28, period, convention, country).day()});
+        }
+        return total;
+    });
+
+    measure(counters, "advance 3M, 15-rule calendar", decade_days, [&] {
+        const datelib::Period period(3, datelib::Period::Unit::Months);
+        int total = 0;
+        for (const auto& date : decade) {
+            total += static_cast<int>(
+                unsigned{datelib::advance(date, period, convention, country).day()});
+        }
+        return total;
+    });
+
+    measure(counters, "getHolidays, 15-rule calendar", 10, [&] {
+        int total = 0;
+        for (int y = 2020; y < 2030; ++y) {
+            total += static_cast<int>(country.getHolidays(y).size());
+        }
+        return total;
+    });
+}
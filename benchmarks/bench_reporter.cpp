@@ -0,0 +1,83 @@
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/benchmark/detail/catch_benchmark_stats.hpp>
+#include <catch2/catch_test_case_info.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+#include <catch2/reporters/catch_reporter_streaming_base.hpp>
+
+namespace {
+
+std::string jsonString(std::string_view text) {
+    std::string quoted = "\"";
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+        }
+        quoted += c;
+    }
+    return quoted + '"';
+}
+
+/**
+ * @brief Reporter writing the mean and spread of every benchmark as JSON
+ *
+ * Catch2's own JSON reporter leaves benchmarks out. bench_json and bench_compare select this one
+ * with --reporter datelib-json::out=<file>.
+ *
+ * Output:
+ * @code
+ *   {"benchmarks": [{"test_case": "...", "name": "...", "samples": 100, "iterations": 1,
+ *                    "mean_ns": 1234.5, "mean_low_ns": ..., "mean_high_ns": ...,
+ *                    "std_dev_ns": ...}, ...]}
+ * @endcode
+ * Durations are in nanoseconds, with one decimal.
+ */
+class BenchmarkJsonReporter final : public Catch::StreamingReporterBase {
+  public:
+    using StreamingReporterBase::StreamingReporterBase;
+
+    static std::string getDescription() {
+        return "Writes the statistics of every benchmark as JSON";
+    }
+
+    void testCaseStarting(const Catch::TestCaseInfo& test_info) override {
+        StreamingReporterBase::testCaseStarting(test_info);
+        test_case_ = test_info.name;
+    }
+
+    void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override {
+        std::ostringstream entry;
+        entry << std::fixed << std::setprecision(1) << "    {\"test_case\": "
+              << jsonString(test_case_) << ", \"name\": " << jsonString(stats.info.name)
+              << ", \"samples\": " << stats.info.samples
+              << ", \"iterations\": " << stats.info.iterations
+              << ", \"mean_ns\": " << stats.mean.point.count()
+              << ", \"mean_low_ns\": " << stats.mean.lower_bound.count()
+              << ", \"mean_high_ns\": " << stats.mean.upper_bound.count()
+              << ", \"std_dev_ns\": " << stats.standardDeviation.point.count() << "}";
+        entries_.push_back(entry.str());
+    }
+
+    void testRunEnded(const Catch::TestRunStats& stats) override {
+        StreamingReporterBase::testRunEnded(stats);
+        m_stream << "{\"benchmarks\": [\n";
+        for (std::size_t i = 0; i < entries_.size(); ++i) {
+            m_stream << entries_[i] << (i + 1 < entries_.size() ? ",\n" : "\n");
+        }
+        m_stream << "]}\n" << std::flush;
+    }
+
+  private:
+    std::string test_case_;
+    std::vector<std::string> entries_;
+};
+
+} // namespace
+
+CATCH_REGISTER_REPORTER("datelib-json", BenchmarkJsonReporter)
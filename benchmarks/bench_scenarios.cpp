@@ -0,0 +1,192 @@
+#include "bench_calendars.h"
+#include "datelib/date.h"
+#include "datelib/period.h"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::chrono;
+
+namespace {
+// Every day of the decade the scenarios run over
+std::vector<year_month_day> makeDecade() {
+    std::vector<year_month_day> dates;
+    for (sys_days day = sys_days{2020y / January / 1}; day < sys_days{2030y / January / 1};
+         day += days{1}) {
+        dates.emplace_back(day);
+    }
+    return dates;
+}
+
+// "1D" to "250D", "1W" to "52W", "1M" to "120M" and "1Y" to "50Y"
+std::vector<std::string> makeTenorStrings() {
+    std::vector<std::string> tenors;
+    for (const auto& [unit, count] : {std::pair{'D', 250}, std::pair{'W', 52},
+                                      std::pair{'M', 120}, std::pair{'Y', 50}}) {
+        for (int n = 1; n <= count; ++n) {
+            tenors.push_back(std::to_string(n) + unit);
+        }
+    }
+    return tenors;
+}
+} // namespace
+
+TEST_CASE("Calendar queries", "[benchmark][HolidayCalendar]") {
+    const datelib::HolidayCalendar country = bench::makeCountryCalendar();
+    const datelib::HolidayCalendar exchange = bench::makeExchangeCalendar();
+    const std::vector<year_month_day> dates = makeDecade();
+
+    // Materialize the years first; the scenarios measure lookups, not the first build
+    for (const auto& date : dates) {
+        (void)country.isHoliday(date);
+        (void)exchange.isHoliday(date);
+    }
+
+    BENCHMARK("isHoliday, 15-rule calendar, decade") {
+        int holidays = 0;
+        for (const auto& date : dates) {
+            holidays += country.isHoliday(date) ? 1 : 0;
+        }
+        return holidays;
+    };
+
+    BENCHMARK("isHoliday, 3000-date calendar, decade") {
+        int holidays = 0;
+        for (const auto& date : dates) {
+            holidays += exchange.isHoliday(date) ? 1 : 0;
+        }
+        return holidays;
+    };
+
+    BENCHMARK("isBusinessDay, 15-rule calendar, decade") {
+        int business_days = 0;
+        for (const auto& date : dates) {
+            business_days += datelib::isBusinessDay(date, country) ? 1 : 0;
+        }
+        return business_days;
+    };
+
+    BENCHMARK("isBusinessDay, 3000-date calendar, decade") {
+        int business_days = 0;
+        for (const auto& date : dates) {
+            business_days += datelib::isBusinessDay(date, exchange) ? 1 : 0;
+        }
+        return business_days;
+    };
+
+    BENCHMARK("getHolidays, 15-rule calendar, decade") {
+        std::size_t holidays = 0;
+        for (int y = 2020; y < 2030; ++y) {
+            holidays += country.getHolidays(y).size();
+        }
+        return holidays;
+    };
+}
+
+TEST_CASE("Large rule calendar", "[benchmark][HolidayCalendar]") {
+    const datelib::HolidayCalendar calendar = bench::makeLargeRuleCalendar();
+    const std::vector<year_month_day> dates = makeDecade();
+    for (const auto& date : dates) {
+        (void)calendar.isHoliday(date);
+    }
+
+    BENCHMARK("isHoliday, 200-rule calendar, decade") {
+        int holidays = 0;
+        for (const auto& date : dates) {
+            holidays += calendar.isHoliday(date) ? 1 : 0;
+        }
+        return holidays;
+    };
+
+    // Names are not cached, so this walks the rules for every holiday
+    BENCHMARK("getHolidayNames, 200-rule calendar, year") {
+        std::size_t names = 0;
+        for (const auto& date : calendar.getHolidays(2024)) {
+            names += calendar.getHolidayNames(date).size();
+        }
+        return names;
+    };
+}
+
+TEST_CASE("ModifiedFollowing over a decade", "[benchmark][adjust]") {
+    const datelib::HolidayCalendar country = bench::makeCountryCalendar();
+    const datelib::HolidayCalendar exchange = bench::makeExchangeCalendar();
+    const std::vector<year_month_day> dates = makeDecade();
+    constexpr auto convention = datelib::BusinessDayConvention::ModifiedFollowing;
+
+    for (const auto& date : dates) {
+        (void)datelib::adjust(date, convention, country);
+        (void)datelib::adjust(date, convention, exchange);
+    }
+
+    BENCHMARK("adjust, 15-rule calendar, decade") {
+        int total = 0;
+        for (const auto& date : dates) {
+            total += static_cast<int>(unsigned{datelib::adjust(date, convention, country).day()});
+        }
+        return total;
+    };
+
+    BENCHMARK("adjust, 3000-date calendar, decade") {
+        int total = 0;
+        for (const auto& date : dates) {
+            total += static_cast<int>(unsigned{datelib::adjust(date, convention, exchange).day()});
+        }
+        return total;
+    };
+}
+
+TEST_CASE("Business day advances", "[benchmark][advance]") {
+    const datelib::HolidayCalendar country = bench::makeCountryCalendar();
+    constexpr auto convention = datelib::BusinessDayConvention::ModifiedFollowing;
+    std::vector<datelib::Period> periods;
+    for (int n = 1; n <= 250; ++n) {
+        periods.emplace_back(n, datelib::Period::Unit::Days);
+    }
+    // One start date a week over a year, so that the advances start from every weekday position
+    std::vector<year_month_day> starts;
+    for (sys_days day = sys_days{2024y / January / 3}; day < sys_days{2025y / January / 1};
+         day += weeks{1}) {
+        starts.emplace_back(day);
+    }
+    const std::vector<year_month_day> decade = makeDecade();
+    (void)datelib::advance(starts.back(), periods.back(), convention, country);
+
+    BENCHMARK("advance 3M ModifiedFollowing, 15-rule calendar, decade") {
+        const datelib::Period period(3, datelib::Period::Unit::Months);
+        int total = 0;
+        for (const auto& date : decade) {
+            total += static_cast<int>(
+                unsigned{datelib::advance(date, period, convention, country).day()});
+        }
+        return total;
+    };
+
+    BENCHMARK("advance 1D-250D, 15-rule calendar") {
+        int total = 0;
+        for (const auto& start : starts) {
+            for (const auto& period : periods) {
+                const auto end = datelib::advance(start, period, convention, country);
+                total += static_cast<int>(unsigned{end.day()});
+            }
+        }
+        return total;
+    };
+}
+
+TEST_CASE("Tenor parsing", "[benchmark][period]") {
+    const std::vector<std::string> tenors = makeTenorStrings();
+
+    BENCHMARK("Period::parse, 472 tenors") {
+        int total = 0;
+        for (const auto& tenor : tenors) {
+            total += datelib::Period::parse(tenor).value();
+        }
+        return total;
+    };
+}
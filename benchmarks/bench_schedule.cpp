@@ -0,0 +1,35 @@
+#include "datelib/HolidayCalendar.h"
+#include "datelib/Schedule.h"
+
+#include <array>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::chrono;
+
+TEST_CASE("Schedule generation", "[benchmark][Schedule]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Independence Day", 7, 4));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    const auto compiled = calendar.compile(2024, 2056);
+
+    // A 30Y semi-annual swap leg
+    const datelib::Period tenor = datelib::Period::parse("6M");
+    constexpr auto convention = datelib::BusinessDayConvention::ModifiedFollowing;
+    std::array<year_month_day, 64> unadjusted{};
+    std::array<year_month_day, 64> adjusted{};
+
+    BENCHMARK("30Y semi-annual schedule") {
+        const datelib::Schedule schedule(2024y / March / 15, 2054y / March / 15, tenor,
+                                         convention);
+        return schedule.generate(unadjusted, adjusted, calendar);
+    };
+
+    BENCHMARK("30Y semi-annual schedule on a compiled calendar") {
+        const datelib::Schedule schedule(2024y / March / 15, 2054y / March / 15, tenor,
+                                         convention);
+        return schedule.generate(unadjusted, adjusted, compiled);
+    };
+}
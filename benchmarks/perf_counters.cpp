@@ -0,0 +1,141 @@
+#include "perf_counters.h"
+
+#include <cstdint>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench {
+
+namespace {
+constexpr std::array<std::string_view, COUNTER_COUNT> COUNTER_NAMES = {
+    "cycles", "instructions", "branch-misses", "L1d-misses", "LLC-misses"};
+
+#if defined(__linux__)
+struct EventConfig {
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+constexpr std::uint64_t cacheEvent(const std::uint64_t cache, const std::uint64_t operation,
+                                   const std::uint64_t result) noexcept {
+    return cache | (operation << 8) | (result << 16);
+}
+
+// In the order of the Counter enumerators
+constexpr std::array<EventConfig, COUNTER_COUNT> EVENTS = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_HW_CACHE, cacheEvent(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ,
+                                    PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {PERF_TYPE_HW_CACHE, cacheEvent(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ,
+                                    PERF_COUNT_HW_CACHE_RESULT_MISS)},
+}};
+
+// Layout of read() for PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING
+struct CounterReading {
+    std::uint64_t value;
+    std::uint64_t time_enabled;
+    std::uint64_t time_running;
+};
+
+int openCounter(const EventConfig& event) noexcept {
+    perf_event_attr attr{};
+    attr.type = event.type;
+    attr.size = sizeof(attr);
+    attr.config = event.config;
+    attr.disabled = 1;
+    // User space only, which perf_event_paranoid up to 2 allows without privileges
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0UL));
+}
+#endif
+} // namespace
+
+std::string_view counterName(const Counter counter) noexcept {
+    return COUNTER_NAMES[static_cast<std::size_t>(counter)];
+}
+
+PerfCounters::PerfCounters() {
+    fds_.fill(-1);
+#if defined(__linux__)
+    for (std::size_t i = 0; i < COUNTER_COUNT; ++i) {
+        fds_[i] = openCounter(EVENTS[i]);
+        if (fds_[i] >= 0) {
+            continue;
+        }
+        const int error = errno;
+        if (!reason_.empty()) {
+            reason_ += "; ";
+        }
+        reason_ += std::string(COUNTER_NAMES[i]) + ": " + std::strerror(error);
+        if (error == EACCES || error == EPERM) {
+            reason_ += " (see /proc/sys/kernel/perf_event_paranoid)";
+        }
+    }
+#else
+    reason_ = "hardware counters need Linux perf_event_open";
+#endif
+}
+
+PerfCounters::~PerfCounters() {
+#if defined(__linux__)
+    for (const int fd : fds_) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+#endif
+}
+
+bool PerfCounters::available() const noexcept {
+    for (const int fd : fds_) {
+        if (fd >= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PerfCounters::start() noexcept {
+#if defined(__linux__)
+    for (const int fd : fds_) {
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+void PerfCounters::stop() noexcept {
+#if defined(__linux__)
+    for (const int fd : fds_) {
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    for (std::size_t i = 0; i < COUNTER_COUNT; ++i) {
+        values_[i].reset();
+        CounterReading reading{};
+        if (fds_[i] < 0 || read(fds_[i], &reading, sizeof(reading)) != sizeof(reading) ||
+            reading.time_running == 0) {
+            continue;
+        }
+        values_[i] = static_cast<double>(reading.value) *
+                     static_cast<double>(reading.time_enabled) /
+                     static_cast<double>(reading.time_running);
+    }
+#endif
+}
+
+} // namespace bench
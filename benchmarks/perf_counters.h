@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace bench {
+
+/**
+ * @brief Hardware events PerfCounters can record
+ */
+enum class Counter : std::size_t { Cycles, Instructions, BranchMisses, L1dMisses, LlcMisses };
+
+inline constexpr std::size_t COUNTER_COUNT = 5;
+
+/**
+ * @brief Short name of a counter, as printed in the benchmark tables
+ */
+[[nodiscard]] std::string_view counterName(Counter counter) noexcept;
+
+/**
+ * @brief User-space hardware counters of the calling thread, read with Linux perf_event_open
+ *
+ * Each counter is opened on its own, so a machine or VM without, say, an LLC event still reports
+ * the others. Nothing throws when counters cannot be opened (no Linux, no PMU, or a
+ * perf_event_paranoid setting that forbids it): available() is false and unavailableReason() says
+ * why. Counts are scaled by the time each counter was actually running, in case the kernel had to
+ * multiplex them.
+ */
+class PerfCounters {
+  public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * @brief Check if at least one counter could be opened
+     */
+    [[nodiscard]] bool available() const noexcept;
+
+    /**
+     * @brief Why counters are missing, empty when every counter could be opened
+     */
+    [[nodiscard]] const std::string& unavailableReason() const noexcept { return reason_; }
+
+    /**
+     * @brief Reset and start every open counter
+     */
+    void start() noexcept;
+
+    /**
+     * @brief Stop every open counter and read the counts since start()
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief Count of an event between the last start() and stop(), if it could be recorded
+     */
+    [[nodiscard]] std::optional<double> value(Counter counter) const noexcept {
+        return values_[static_cast<std::size_t>(counter)];
+    }
+
+  private:
+    std::array<int, COUNTER_COUNT> fds_;
+    std::array<std::optional<double>, COUNTER_COUNT> values_{};
+    std::string reason_;
+};
+
+} // namespace bench
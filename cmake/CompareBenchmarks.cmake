@@ -0,0 +1,205 @@
+# Compare benchmark results against a baseline, both written by the datelib-json reporter
+#
+#   cmake -DBASELINE=<file> -DRESULTS=<file> [-DTOLERANCE_PERCENT=10] -P CompareBenchmarks.cmake
+#
+# Scenarios are identified by their test case and name. Prints the mean of every scenario in both
+# files with the change between them, and fails when a baseline scenario is missing from the
+# results or is slower beyond its noise: when even the low end of its current mean's confidence
+# interval (mean_low_ns) exceeds the high end of the baseline's (mean_high_ns) by more than
+# TOLERANCE_PERCENT. Scenarios without a baseline are listed but not checked.
+
+cmake_minimum_required(VERSION 3.31)
+
+foreach(required BASELINE RESULTS)
+  if(NOT DEFINED ${required})
+    message(FATAL_ERROR "CompareBenchmarks.cmake needs -D${required}=<file>")
+  endif()
+endforeach()
+if(NOT DEFINED TOLERANCE_PERCENT)
+  set(TOLERANCE_PERCENT 10)
+endif()
+if(NOT TOLERANCE_PERCENT MATCHES "^[0-9]+$")
+  message(FATAL_ERROR "TOLERANCE_PERCENT must be a whole number, got '${TOLERANCE_PERCENT}'")
+endif()
+
+# Parse a duration in nanoseconds into tenths of a nanosecond, the precision the reporter writes,
+# for integer arithmetic
+function(parse_tenths value context out)
+  if(value MATCHES "^([0-9]+)\\.([0-9])")
+    math(EXPR tenths "${CMAKE_MATCH_1} * 10 + ${CMAKE_MATCH_2}")
+  elseif(value MATCHES "^[0-9]+$")
+    math(EXPR tenths "${value} * 10")
+  else()
+    message(FATAL_ERROR "Unexpected duration '${value}' for ${context}")
+  endif()
+  set(${out} "${tenths}" PARENT_SCOPE)
+endfunction()
+
+# Read the scenarios ("<test case>: <name>") of a results file with their means and the bounds of
+# the means' confidence intervals, in tenths of a nanosecond
+function(read_results file out_keys out_means out_lows out_highs)
+  if(NOT EXISTS "${file}")
+    message(FATAL_ERROR "Benchmark results not found: ${file}")
+  endif()
+  file(READ "${file}" json)
+  string(JSON count LENGTH "${json}" benchmarks)
+  set(keys "")
+  set(means "")
+  set(lows "")
+  set(highs "")
+  if(count GREATER 0)
+    math(EXPR last "${count} - 1")
+    foreach(index RANGE ${last})
+      string(JSON test_case GET "${json}" benchmarks ${index} test_case)
+      string(JSON name GET "${json}" benchmarks ${index} name)
+      set(key "${test_case}: ${name}")
+      foreach(field mean mean_low mean_high)
+        string(JSON value GET "${json}" benchmarks ${index} ${field}_ns)
+        parse_tenths("${value}" "${field}_ns of '${key}' in ${file}" ${field})
+      endforeach()
+      list(APPEND keys "${key}")
+      list(APPEND means "${mean}")
+      list(APPEND lows "${mean_low}")
+      list(APPEND highs "${mean_high}")
+    endforeach()
+  endif()
+  set(${out_keys} "${keys}" PARENT_SCOPE)
+  set(${out_means} "${means}" PARENT_SCOPE)
+  set(${out_lows} "${lows}" PARENT_SCOPE)
+  set(${out_highs} "${highs}" PARENT_SCOPE)
+endfunction()
+
+# Format a duration given in tenths of a nanosecond
+function(format_duration tenths out)
+  if(tenths GREATER_EQUAL 10000000)
+    math(EXPR whole "${tenths} / 10000000")
+    math(EXPR fraction "${tenths} / 100000 % 100")
+    set(unit "ms")
+  elseif(tenths GREATER_EQUAL 10000)
+    math(EXPR whole "${tenths} / 10000")
+    math(EXPR fraction "${tenths} / 100 % 100")
+    set(unit "us")
+  else()
+    math(EXPR whole "${tenths} / 10")
+    math(EXPR fraction "${tenths} % 10 * 10")
+    set(unit "ns")
+  endif()
+  if(fraction LESS 10)
+    set(fraction "0${fraction}")
+  endif()
+  set(${out} "${whole}.${fraction} ${unit}" PARENT_SCOPE)
+endfunction()
+
+# Format a change given in tenths of a percent
+function(format_change permille out)
+  if(permille LESS 0)
+    math(EXPR magnitude "-(${permille})")
+    set(sign "-")
+  else()
+    set(magnitude ${permille})
+    set(sign "+")
+  endif()
+  math(EXPR whole "${magnitude} / 10")
+  math(EXPR tenth "${magnitude} % 10")
+  set(${out} "${sign}${whole}.${tenth}%" PARENT_SCOPE)
+endfunction()
+
+function(pad_right text width out)
+  string(LENGTH "${text}" length)
+  while(length LESS width)
+    string(APPEND text " ")
+    math(EXPR length "${length} + 1")
+  endwhile()
+  set(${out} "${text}" PARENT_SCOPE)
+endfunction()
+
+function(pad_left text width out)
+  string(LENGTH "${text}" length)
+  while(length LESS width)
+    set(text " ${text}")
+    math(EXPR length "${length} + 1")
+  endwhile()
+  set(${out} "${text}" PARENT_SCOPE)
+endfunction()
+
+read_results("${BASELINE}" baseline_keys baseline_means baseline_lows baseline_highs)
+read_results("${RESULTS}" result_keys result_means result_lows result_highs)
+
+set(all_keys ${baseline_keys} ${result_keys})
+list(REMOVE_DUPLICATES all_keys)
+set(name_width 8)
+foreach(key IN LISTS all_keys)
+  string(LENGTH "${key}" length)
+  if(length GREATER name_width)
+    set(name_width ${length})
+  endif()
+endforeach()
+
+math(EXPR tolerance_permille "${TOLERANCE_PERCENT} * 10")
+set(regressions 0)
+
+pad_right("scenario" ${name_width} name_column)
+pad_left("baseline" 12 baseline_column)
+pad_left("current" 12 result_column)
+pad_left("change" 9 change_column)
+set(table "${name_column} ${baseline_column} ${result_column} ${change_column}\n")
+
+foreach(key IN LISTS all_keys)
+  list(FIND baseline_keys "${key}" baseline_index)
+  list(FIND result_keys "${key}" result_index)
+  set(baseline_text "-")
+  set(result_text "-")
+  set(change_text "")
+  if(baseline_index GREATER_EQUAL 0)
+    list(GET baseline_means ${baseline_index} baseline_mean)
+    list(GET baseline_highs ${baseline_index} baseline_high)
+    format_duration(${baseline_mean} baseline_text)
+  endif()
+  if(result_index GREATER_EQUAL 0)
+    list(GET result_means ${result_index} result_mean)
+    list(GET result_lows ${result_index} result_low)
+    format_duration(${result_mean} result_text)
+  endif()
+
+  if(baseline_index LESS 0)
+    set(status "new")
+  elseif(result_index LESS 0)
+    set(status "MISSING")
+    math(EXPR regressions "${regressions} + 1")
+  else()
+    if(baseline_mean LESS 1)
+      set(baseline_mean 1)
+    endif()
+    if(baseline_high LESS 1)
+      set(baseline_high 1)
+    endif()
+    math(EXPR change "(${result_mean} - ${baseline_mean}) * 1000 / ${baseline_mean}")
+    format_change(${change} change_text)
+    # Only a slowdown that the confidence intervals of both runs cannot explain counts
+    math(EXPR excess "(${result_low} - ${baseline_high}) * 1000 / ${baseline_high}")
+    if(excess GREATER tolerance_permille)
+      set(status "REGRESSION")
+      math(EXPR regressions "${regressions} + 1")
+    elseif(change GREATER tolerance_permille)
+      set(status "noisy")
+    else()
+      set(status "ok")
+    endif()
+  endif()
+
+  pad_right("${key}" ${name_width} name_column)
+  pad_left("${baseline_text}" 12 baseline_column)
+  pad_left("${result_text}" 12 result_column)
+  pad_left("${change_text}" 9 change_column)
+  string(APPEND table
+    "${name_column} ${baseline_column} ${result_column} ${change_column}  ${status}\n")
+endforeach()
+
+message("${table}")
+if(regressions GREATER 0)
+  message(FATAL_ERROR
+    "${regressions} scenario(s) slower than ${BASELINE} by more than ${TOLERANCE_PERCENT}% "
+    "beyond the confidence intervals, or missing from the results")
+endif()
+message("No scenario slower than the baseline by more than ${TOLERANCE_PERCENT}% "
+        "beyond the confidence intervals")
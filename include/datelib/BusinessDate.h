@@ -0,0 +1,212 @@
+#pragma once
+
+#include <chrono>
+#include <compare>
+#include <cstdint>
+
+namespace datelib {
+
+/**
+ * @brief Compact date stored as a 32-bit count of days since 1970-01-01
+ *
+ * BusinessDate holds the same day number as std::chrono::sys_days, in 32 bits, so stepping,
+ * comparing and taking the weekday are plain integer operations. Conversions to and from the
+ * civil year/month/day use the Neri-Schneider algorithms (C. Neri and L. Schneider, "Euclidean
+ * affine functions and their application to calendar algorithms", 2022): a handful of
+ * multiplications and shifts without any division by a non-constant, all constexpr.
+ *
+ * Every year representable by std::chrono::year (-32767 to 32767) is supported. The calendar
+ * functions have overloads taking a BusinessDate so that inner loops never go through
+ * std::chrono::year_month_day.
+ *
+ * Example usage:
+ * @code
+ *   constexpr BusinessDate date{2024y / March / 15};
+ *   static_assert(date.month() == 3 && (date + 17).day() == 1);
+ * @endcode
+ */
+class BusinessDate {
+  public:
+    using rep = std::int32_t;
+
+    /**
+     * @brief Civil year, month and day of a date
+     */
+    struct Civil {
+        int year;
+        unsigned month;
+        unsigned day;
+
+        [[nodiscard]] constexpr bool operator==(const Civil& other) const noexcept = default;
+    };
+
+    /**
+     * @brief Construct the date 1970-01-01
+     */
+    constexpr BusinessDate() noexcept = default;
+
+    /**
+     * @brief Construct from a std::chrono::sys_days
+     */
+    constexpr explicit BusinessDate(const std::chrono::sys_days date) noexcept
+        : serial_(static_cast<rep>(date.time_since_epoch().count())) {}
+
+    /**
+     * @brief Construct from a year_month_day
+     * @param date The date (must be valid)
+     */
+    constexpr explicit BusinessDate(const std::chrono::year_month_day& date) noexcept
+        : serial_(serialOf(static_cast<int>(date.year()), unsigned{date.month()},
+                           unsigned{date.day()})) {}
+
+    /**
+     * @brief Construct from a day count since 1970-01-01
+     */
+    [[nodiscard]] static constexpr BusinessDate fromSerial(const rep serial) noexcept {
+        BusinessDate date;
+        date.serial_ = serial;
+        return date;
+    }
+
+    /**
+     * @brief Day count of a civil date since 1970-01-01
+     * @param year The year, in [-32767, 32767]
+     * @param month The month, in [1, 12]
+     * @param day The day of month, valid for the month
+     */
+    [[nodiscard]] static constexpr rep serialOf(const int year, const unsigned month,
+                                                const unsigned day) noexcept {
+        // Shift to March-based years so that the leap day ends the year
+        const std::uint32_t january_or_february = month <= 2 ? 1 : 0;
+        const std::uint32_t shifted_year =
+            static_cast<std::uint32_t>(year + YEAR_SHIFT) - january_or_february;
+        const std::uint32_t shifted_month = january_or_february != 0 ? month + 12 : month;
+        const std::uint32_t century = shifted_year / 100;
+
+        const std::uint32_t year_days = 1461 * shifted_year / 4 - century + century / 4;
+        const std::uint32_t month_days = (979 * shifted_month - 2919) / 32;
+        return static_cast<rep>(year_days + month_days + day - 1 - DAY_SHIFT);
+    }
+
+    /**
+     * @brief Get the day count since 1970-01-01
+     */
+    [[nodiscard]] constexpr rep serial() const noexcept { return serial_; }
+
+    /**
+     * @brief Get the civil year, month and day
+     */
+    [[nodiscard]] constexpr Civil civil() const noexcept {
+        const std::uint32_t shifted = static_cast<std::uint32_t>(serial_) + DAY_SHIFT;
+
+        // Century and day of century
+        const std::uint32_t n1 = 4 * shifted + 3;
+        const std::uint32_t century = n1 / DAYS_PER_400_YEARS;
+        const std::uint32_t day_of_century = n1 % DAYS_PER_400_YEARS / 4;
+
+        // Year of century and day of year, with a single 64-bit multiplication
+        const std::uint64_t p2 = std::uint64_t{2939745} * (4 * day_of_century + 3);
+        const auto year_of_century = static_cast<std::uint32_t>(p2 >> 32);
+        const std::uint32_t day_of_year = static_cast<std::uint32_t>(p2) / 2939745 / 4;
+
+        // Month and day of month of the March-based year
+        const std::uint32_t n3 = 2141 * day_of_year + 197913;
+        const std::uint32_t month = n3 >> 16;
+        const std::uint32_t day = (n3 & 0xFFFF) / 2141;
+
+        // Back to January-based years
+        const std::uint32_t january_or_february = day_of_year >= 306 ? 1 : 0;
+        const int year =
+            static_cast<int>(100 * century + year_of_century + january_or_february) - YEAR_SHIFT;
+        return {year, january_or_february != 0 ? month - 12 : month, day + 1};
+    }
+
+    [[nodiscard]] constexpr int year() const noexcept { return civil().year; }
+    [[nodiscard]] constexpr unsigned month() const noexcept { return civil().month; }
+    [[nodiscard]] constexpr unsigned day() const noexcept { return civil().day; }
+
+    /**
+     * @brief Get the weekday
+     */
+    [[nodiscard]] constexpr std::chrono::weekday weekday() const noexcept {
+        // 1970-01-01 was a Thursday (C encoding 4); keep the remainder non-negative
+        const rep remainder = (serial_ + 4) % 7;
+        return std::chrono::weekday{static_cast<unsigned>(remainder < 0 ? remainder + 7
+                                                                        : remainder)};
+    }
+
+    /**
+     * @brief Get the zero-based day of the year (0 for January 1st)
+     */
+    [[nodiscard]] constexpr unsigned dayOfYear() const noexcept {
+        return static_cast<unsigned>(serial_ - serialOf(year(), 1, 1));
+    }
+
+    /**
+     * @brief Convert to std::chrono::sys_days
+     */
+    [[nodiscard]] constexpr std::chrono::sys_days toSysDays() const noexcept {
+        return std::chrono::sys_days{std::chrono::days{serial_}};
+    }
+
+    /**
+     * @brief Convert to std::chrono::year_month_day
+     */
+    [[nodiscard]] constexpr std::chrono::year_month_day toYearMonthDay() const noexcept {
+        const Civil date = civil();
+        return std::chrono::year_month_day{std::chrono::year{date.year},
+                                           std::chrono::month{date.month},
+                                           std::chrono::day{date.day}};
+    }
+
+    constexpr BusinessDate& operator+=(const rep days) noexcept {
+        serial_ += days;
+        return *this;
+    }
+
+    constexpr BusinessDate& operator-=(const rep days) noexcept {
+        serial_ -= days;
+        return *this;
+    }
+
+    constexpr BusinessDate& operator++() noexcept {
+        ++serial_;
+        return *this;
+    }
+
+    constexpr BusinessDate& operator--() noexcept {
+        --serial_;
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr BusinessDate operator+(BusinessDate date,
+                                                          const rep days) noexcept {
+        return date += days;
+    }
+
+    [[nodiscard]] friend constexpr BusinessDate operator-(BusinessDate date,
+                                                          const rep days) noexcept {
+        return date -= days;
+    }
+
+    /**
+     * @brief Number of days from rhs to lhs
+     */
+    [[nodiscard]] friend constexpr rep operator-(const BusinessDate lhs,
+                                                 const BusinessDate rhs) noexcept {
+        return lhs.serial_ - rhs.serial_;
+    }
+
+    [[nodiscard]] constexpr auto operator<=>(const BusinessDate& other) const noexcept = default;
+
+  private:
+    // Years are shifted so that every supported date has a positive, 32-bit computation
+    static constexpr int YEAR_SHIFT = 400 * 82;
+    static constexpr std::uint32_t DAYS_PER_400_YEARS = 146097;
+    // Days from 0000-03-01 of the shifted calendar to 1970-01-01
+    static constexpr std::uint32_t DAY_SHIFT = 719468 + DAYS_PER_400_YEARS * 82;
+
+    rep serial_{0};
+};
+
+} // namespace datelib
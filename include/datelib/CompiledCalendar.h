@@ -0,0 +1,315 @@
+#pragma once
+
+#include "datelib/BusinessDate.h"
+#include "datelib/date.h"
+#include "datelib/period.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <vector>
+
+namespace datelib {
+
+namespace detail {
+
+/**
+ * @brief Allocator handing out storage aligned to a cache line
+ */
+template <typename T>
+struct CacheLineAllocator {
+    using value_type = T;
+
+    static constexpr std::size_t ALIGNMENT = 64;
+
+    CacheLineAllocator() noexcept = default;
+
+    template <typename U>
+    CacheLineAllocator(const CacheLineAllocator<U>& /*other*/) noexcept {}
+
+    [[nodiscard]] T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ALIGNMENT}));
+    }
+
+    void deallocate(T* p, std::size_t /*n*/) noexcept {
+        ::operator delete(p, std::align_val_t{ALIGNMENT});
+    }
+
+    template <typename U>
+    bool operator==(const CacheLineAllocator<U>& /*other*/) const noexcept {
+        return true;
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Read-only snapshot of a HolidayCalendar over a fixed range of years
+ *
+ * A CompiledCalendar is produced by HolidayCalendar::compile() and stores, for every day of the
+ * range, whether it is a holiday and whether it is a business day (not a holiday and not a
+ * weekend day) as flat, cache-line-aligned bit arrays. Queries are plain bit tests and bit scans:
+ * no rule evaluation, virtual call, string or hash set is involved, so a compiled calendar is the
+ * preferred runtime format once a calendar has been built. A table of the distances from every
+ * day to the previous and the next business day lets adjust() resolve any convention with one
+ * load and no search.
+ *
+ * The snapshot does not follow later changes to the calendar it was compiled from, and since it
+ * is immutable it can be shared freely between threads.
+ *
+ * Example usage:
+ * @code
+ *   const auto compiled = calendar.compile(2020, 2070);
+ *   compiled.isBusinessDay(year_month_day{year{2024}, month{12}, day{25}}); // false
+ *   compiled.adjust(date, BusinessDayConvention::ModifiedFollowing);
+ * @endcode
+ */
+class CompiledCalendar {
+  public:
+    /**
+     * @brief Get the first year covered by this calendar
+     */
+    [[nodiscard]] int firstYear() const noexcept { return first_year_; }
+
+    /**
+     * @brief Get the last year covered by this calendar (inclusive)
+     */
+    [[nodiscard]] int lastYear() const noexcept { return last_year_; }
+
+    /**
+     * @brief Check whether a date lies inside the compiled year range
+     * @param date The date to check
+     * @return true if the date is valid and within [firstYear(), lastYear()]
+     */
+    [[nodiscard]] bool contains(const std::chrono::year_month_day& date) const noexcept;
+
+    /**
+     * @brief Check if a given date is a holiday
+     * @param date The date to check
+     * @return true if the date is a holiday, false otherwise
+     * @throws std::invalid_argument if the date is invalid
+     * @throws DateOutOfRangeException if the date is outside the compiled range
+     */
+    [[nodiscard]] bool isHoliday(const std::chrono::year_month_day& date) const;
+
+    /**
+     * @brief Check if a given serial date is a holiday
+     * @throws DateOutOfRangeException if the date is outside the compiled range
+     */
+    [[nodiscard]] bool isHoliday(BusinessDate date) const;
+
+    /**
+     * @brief Check if a given date is a business day
+     * @param date The date to check
+     * @return true if the date is neither a weekend day nor a holiday
+     * @throws std::invalid_argument if the date is invalid
+     * @throws DateOutOfRangeException if the date is outside the compiled range
+     */
+    [[nodiscard]] bool isBusinessDay(const std::chrono::year_month_day& date) const;
+
+    /**
+     * @brief Check if a given serial date is a business day
+     * @throws DateOutOfRangeException if the date is outside the compiled range
+     */
+    [[nodiscard]] bool isBusinessDay(BusinessDate date) const;
+
+    /**
+     * @brief Check whether each date of a batch is a business day
+     * @param dates The dates to check
+     * @param out Receives 1 for each business day and 0 for each other day; must have the same
+     * size as dates
+     * @throws std::invalid_argument if out and dates differ in size
+     * @throws DateOutOfRangeException if any date is outside the compiled range (out is then
+     * left partially written)
+     *
+     * On x86-64 CPUs with AVX2 the lookup runs four or eight dates at a time with a vector gather
+     * from the business day plane; elsewhere a scalar loop is used. The choice is made at runtime.
+     */
+    void isBusinessDay(std::span<const std::chrono::sys_days> dates,
+                       std::span<std::uint8_t> out) const;
+
+    /**
+     * @brief Count the business days between two dates in constant time
+     * @param from The start date (excluded)
+     * @param to The end date (included)
+     * @return The number of business days in (from, to], or minus the number of business days
+     * in (to, from] if to is before from
+     * @throws std::invalid_argument if either date is invalid
+     * @throws DateOutOfRangeException if either date is outside the compiled range
+     *
+     * The count matches advance(): advancing from by businessDaysBetween(from, to) business
+     * days lands on to whenever to is a business day.
+     */
+    [[nodiscard]] int businessDaysBetween(const std::chrono::year_month_day& from,
+                                          const std::chrono::year_month_day& to) const;
+
+    /**
+     * @brief Adjust a date according to a business day convention
+     * @param date The date to adjust
+     * @param convention The business day convention to apply
+     * @return The adjusted date, with the same semantics as datelib::adjust()
+     * @throws std::invalid_argument if the date is invalid
+     * @throws DateOutOfRangeException if the date is outside the compiled range
+     * @throws BusinessDaySearchException if no business day exists between the date and the
+     * boundary of the compiled range
+     */
+    [[nodiscard]] std::chrono::year_month_day adjust(const std::chrono::year_month_day& date,
+                                                     BusinessDayConvention convention) const;
+
+    /**
+     * @brief Adjust a serial date according to a business day convention
+     * @throws DateOutOfRangeException if the date is outside the compiled range
+     * @throws BusinessDaySearchException if no business day exists between the date and the
+     * boundary of the compiled range
+     */
+    [[nodiscard]] BusinessDate adjust(BusinessDate date, BusinessDayConvention convention) const;
+
+    /**
+     * @brief Adjust each date of a batch according to a business day convention
+     * @param dates The dates to adjust
+     * @param out Receives the adjusted dates; must have the same size as dates and may be the
+     * same storage
+     * @param convention The business day convention to apply
+     * @throws std::invalid_argument if out and dates differ in size
+     * @throws DateOutOfRangeException if any date is outside the compiled range
+     * @throws BusinessDaySearchException if a search leaves the compiled range
+     *
+     * Business days are detected with the same vectorized lookup as the batch isBusinessDay();
+     * only the remaining dates go through a search.
+     */
+    void adjust(std::span<const std::chrono::sys_days> dates, std::span<std::chrono::sys_days> out,
+                BusinessDayConvention convention) const;
+
+    /**
+     * @brief Advance a date by a period and adjust according to business day convention
+     * @param date The starting date
+     * @param period The period to advance
+     * @param convention The business day convention to apply after advancing
+     * @return The advanced and adjusted date, with the same semantics as datelib::advance()
+     *
+     * Business day periods (Days) are resolved with a lookup in the business day count index
+     * (a binary search over 64-day words), so their cost does not depend on the period length.
+     *
+     * @throws InvalidDateException if the input date is invalid
+     * @throws DateOutOfRangeException if the start or the advanced date is outside the range
+     * @throws BusinessDaySearchException if no business day exists between the advanced date
+     * and the boundary of the compiled range
+     */
+    [[nodiscard]] std::chrono::year_month_day advance(const std::chrono::year_month_day& date,
+                                                      const Period& period,
+                                                      BusinessDayConvention convention) const;
+
+    /**
+     * @brief Advance one date by each period of a tenor grid and adjust the results
+     * @param anchor The starting date shared by all periods (e.g. the spot date of a curve)
+     * @param periods The periods to advance by, e.g. the pillars 1W, 1M, ..., 50Y
+     * @param out Receives the advanced and adjusted dates; must have the same size as periods
+     * @param convention The business day convention to apply after advancing
+     *
+     * Each result equals advance(anchor, periods[i], convention). The anchor is decomposed into
+     * year, month and day once for the whole grid, and a compiled calendar can be reused for
+     * every curve and scenario sharing it.
+     *
+     * @throws InvalidDateException if the anchor is invalid
+     * @throws std::invalid_argument if out and periods differ in size
+     * @throws DateOutOfRangeException if the anchor or an advanced date is outside the range
+     * @throws BusinessDaySearchException if no business day exists between an advanced date
+     * and the boundary of the compiled range
+     */
+    void advance(const std::chrono::year_month_day& anchor, std::span<const Period> periods,
+                 std::span<std::chrono::year_month_day> out,
+                 BusinessDayConvention convention) const;
+
+  private:
+    friend class HolidayCalendar;
+
+    using BitVector = std::vector<std::uint64_t, detail::CacheLineAllocator<std::uint64_t>>;
+
+    // Returned by the business day searches when the range boundary is reached
+    static constexpr std::size_t NPOS = static_cast<std::size_t>(-1);
+
+    /**
+     * @brief Construct an empty calendar (every day a business day) for [first_year, last_year]
+     */
+    CompiledCalendar(int first_year, int last_year);
+
+    void markHoliday(std::size_t index) noexcept;
+    void markNonBusinessDay(std::size_t index) noexcept;
+
+    /**
+     * @brief Days from a day to the next business day at or after it and to the previous one at
+     * or before it; FAR_DISTANCE when that business day is further or outside the range
+     */
+    struct BusinessDayDistance {
+        std::uint8_t next;
+        std::uint8_t previous;
+    };
+
+    static constexpr std::uint8_t FAR_DISTANCE = 255;
+
+    /**
+     * @brief Build the business day count index and the distance table once all days have been
+     * marked
+     */
+    void buildIndex();
+
+    /**
+     * @brief Position of a date in the bit arrays
+     * @throws DateOutOfRangeException if the date is outside the compiled range
+     */
+    [[nodiscard]] std::size_t indexOf(const std::chrono::year_month_day& date) const;
+    [[nodiscard]] std::size_t indexOf(BusinessDate date) const;
+    [[nodiscard]] std::chrono::year_month_day dateAt(std::size_t index) const noexcept;
+    [[nodiscard]] BusinessDate businessDateAt(std::size_t index) const noexcept;
+
+    [[nodiscard]] bool holidayBit(std::size_t index) const noexcept;
+    [[nodiscard]] bool businessBit(std::size_t index) const noexcept;
+
+    /**
+     * @brief First business day at or after index, or NPOS
+     */
+    [[nodiscard]] std::size_t nextBusinessDay(std::size_t index) const noexcept;
+
+    /**
+     * @brief Last business day at or before index, or NPOS
+     */
+    [[nodiscard]] std::size_t previousBusinessDay(std::size_t index) const noexcept;
+
+    /**
+     * @brief Number of business days strictly before index
+     */
+    [[nodiscard]] std::size_t businessRank(std::size_t index) const noexcept;
+
+    /**
+     * @brief Position of the business day with the given zero-based rank, or NPOS
+     */
+    [[nodiscard]] std::size_t selectBusinessDay(std::size_t rank) const noexcept;
+
+    [[nodiscard]] std::size_t adjustIndex(std::size_t index,
+                                          BusinessDayConvention convention) const;
+
+    /**
+     * @brief Position of the business day reached by adding business days to index
+     * @param convention The convention of the calling advance, reported if the search fails
+     * @throws BusinessDaySearchException if it lies outside the compiled range
+     */
+    [[nodiscard]] std::size_t addBusinessDaysIndex(std::size_t index, int business_days,
+                                                   BusinessDayConvention convention) const;
+
+    int first_year_;
+    int last_year_;
+    std::chrono::sys_days first_day_;
+    std::size_t num_days_;
+    // Words per bit plane, rounded up to a whole cache line
+    std::size_t plane_words_;
+    // Holiday plane followed by the business day plane, in one aligned block
+    BitVector bits_;
+    // Business days before each word of the business day plane, plus the total at the end
+    std::vector<std::uint32_t> business_rank_;
+    // Distances to the nearest business days, for every day of the range
+    std::vector<BusinessDayDistance> distances_;
+};
+
+} // namespace datelib
@@ -1,16 +1,89 @@
 #pragma once
 
+#include "datelib/BusinessDate.h"
+#include "datelib/CompiledCalendar.h"
 #include "datelib/HolidayRule.h"
+#include "datelib/date_util.h"
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <string>
+#include <unordered_set>
+#include <utility>
+#include <variant>
 #include <vector>
 
 namespace datelib {
 
+namespace detail {
+
+struct HolidayWords;
+
+/**
+ * @brief Owning handle to a rule type the calendar does not store inline
+ *
+ * Copies are deep copies made through HolidayRule::clone().
+ */
+class CustomRule {
+  public:
+    explicit CustomRule(std::unique_ptr<HolidayRule> rule) noexcept : rule_(std::move(rule)) {}
+
+    CustomRule(const CustomRule& other) : rule_(other.rule_->clone()) {}
+
+    CustomRule& operator=(const CustomRule& other) {
+        if (this != &other) {
+            rule_ = other.rule_->clone();
+        }
+        return *this;
+    }
+
+    CustomRule(CustomRule&& other) noexcept = default;
+    CustomRule& operator=(CustomRule&& other) noexcept = default;
+    ~CustomRule() = default;
+
+    [[nodiscard]] const HolidayRule& get() const noexcept { return *rule_; }
+
+  private:
+    std::unique_ptr<HolidayRule> rule_;
+};
+
+/**
+ * @brief A recurring rule as stored by HolidayCalendar
+ *
+ * The built-in rule types are held by value so that a calendar's rules sit in one contiguous
+ * array and are evaluated without virtual dispatch; any other HolidayRule goes through
+ * CustomRule. Explicit dates are not rules in this sense: they live in a sorted array of
+ * ExplicitHoliday.
+ */
+using StoredRule = std::variant<FixedDateRule, NthWeekdayRule, EasterRule, OffsetFromRule,
+                                ObservedRule, CustomRule>;
+
+/**
+ * @brief A one-off holiday as stored by HolidayCalendar
+ */
+struct ExplicitHoliday {
+    std::chrono::sys_days date;
+    std::string name;
+};
+
+} // namespace detail
+
 /**
  * @brief A calendar that manages holidays using rule-based generation
+ *
+ * The rules of a year are evaluated the first time that year is queried and the result is kept
+ * as a per-year bitmap, so that subsequent lookups for the same year are a single bit test.
+ * Adding a holiday or a rule discards all cached years.
+ *
+ * The const member functions may be called from any number of threads at once. Each year is
+ * built exactly once, under a lock, and then published atomically: lookups of a year that has
+ * been built take no lock and write no shared memory, so readers scale with the number of cores.
+ * Adding holidays or rules must not overlap with any other call on the same calendar.
  */
 class HolidayCalendar {
   public:
@@ -32,12 +105,12 @@ class HolidayCalendar {
     /**
      * @brief Move constructor
      */
-    HolidayCalendar(HolidayCalendar&& other) noexcept = default;
+    HolidayCalendar(HolidayCalendar&& other) noexcept;
 
     /**
      * @brief Move assignment operator
      */
-    HolidayCalendar& operator=(HolidayCalendar&& other) noexcept = default;
+    HolidayCalendar& operator=(HolidayCalendar&& other) noexcept;
 
     /**
      * @brief Destructor
@@ -48,12 +121,32 @@ class HolidayCalendar {
      * @brief Add an explicit holiday date
      * @param name The name of the holiday
      * @param date The date to mark as a holiday
+     * @throws std::invalid_argument if the date is invalid
+     *
+     * Explicit dates are kept sorted, so a year only ever looks at its own explicit dates.
+     * Adding dates in chronological order is cheapest; for large sets prefer addHolidays().
      */
     void addHoliday(const std::string& name, const std::chrono::year_month_day& date);
 
+    /**
+     * @brief Add many explicit holiday dates at once
+     * @param holidays Pairs of holiday name and date
+     * @throws std::invalid_argument if any date is invalid (the calendar is then left unchanged)
+     *
+     * Bulk loading sorts the new dates once and merges them with the existing ones, which is
+     * much faster than repeated addHoliday() calls for thousands of out-of-order dates.
+     */
+    void addHolidays(std::span<const std::pair<std::string, std::chrono::year_month_day>> holidays);
+
     /**
      * @brief Add a rule for generating holidays
      * @param rule The holiday rule to add (ownership is transferred)
+     * @throws std::invalid_argument if rule is null
+     *
+     * Rules whose dynamic type is exactly one of the built-in rule types (ExplicitDateRule,
+     * FixedDateRule, NthWeekdayRule, EasterRule, OffsetFromRule or ObservedRule) are moved into
+     * the calendar's inline storage (explicit dates into the sorted explicit date store); other
+     * rule types are kept behind their pointer.
      */
     void addRule(std::unique_ptr<HolidayRule> rule);
 
@@ -64,6 +157,13 @@ class HolidayCalendar {
      */
     [[nodiscard]] bool isHoliday(const std::chrono::year_month_day& date) const;
 
+    /**
+     * @brief Check if a given date is a holiday
+     * @param date The date to check
+     * @return true if the date is a holiday, false otherwise
+     */
+    [[nodiscard]] bool isHoliday(BusinessDate date) const;
+
     /**
      * @brief Get all holidays for a given year
      * @param year The year to get holidays for
@@ -79,8 +179,143 @@ class HolidayCalendar {
     [[nodiscard]] std::vector<std::string>
     getHolidayNames(const std::chrono::year_month_day& date) const;
 
+    /**
+     * @brief Compile the calendar into an immutable snapshot covering a range of years
+     * @param first_year The first year to include
+     * @param last_year The last year to include (inclusive)
+     * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+     * @return A CompiledCalendar answering holiday and business day queries for the range
+     * @throws std::invalid_argument if the range is empty or not made of valid years
+     *
+     * The snapshot is independent of this calendar: later calls to addHoliday() or addRule()
+     * do not affect it.
+     */
+    [[nodiscard]] CompiledCalendar
+    compile(int first_year, int last_year,
+            WeekendMask weekend = WeekendMask::saturdaySunday()) const;
+
+    /**
+     * @brief Compile the calendar into an immutable snapshot covering a range of years
+     * @param first_year The first year to include
+     * @param last_year The last year to include (inclusive)
+     * @param weekend_days The set of weekdays considered as weekend
+     * @return A CompiledCalendar answering holiday and business day queries for the range
+     * @throws std::invalid_argument if the range is empty or not made of valid years
+     */
+    [[nodiscard]] CompiledCalendar
+    compile(int first_year, int last_year,
+            const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) const;
+
+    /**
+     * @brief Get a compiled snapshot covering a range of years, reusing the last one if it can
+     * @param first_year The first year to include
+     * @param last_year The last year to include (inclusive)
+     * @param weekend The weekdays considered as weekend
+     * @return A CompiledCalendar covering at least [first_year, last_year] with this weekend
+     * @throws std::invalid_argument if the range is empty or not made of valid years
+     *
+     * The calendar keeps the snapshot last compiled this way, so that repeated calls over the
+     * same years (such as the batch isBusinessDay() and adjust()) compile only once. Adding a
+     * holiday or a rule discards it; snapshots already handed out stay valid.
+     */
+    [[nodiscard]] std::shared_ptr<const CompiledCalendar>
+    compileShared(int first_year, int last_year, WeekendMask weekend) const;
+
   private:
-    std::vector<std::unique_ptr<HolidayRule>> rules_;
+    // Combines the per-year bitmaps of several calendars
+    friend class JointCalendar;
+    // Walks the per-year bitmaps when adding business days
+    friend struct detail::HolidayWords;
+
+    /**
+     * @brief Holidays of a single year, one bit per day of the year (bit 0 is January 1)
+     */
+    struct YearBitmap {
+        // 366 days rounded up to whole 64-bit words
+        static constexpr std::size_t WORDS = 6;
+
+        std::array<std::uint64_t, WORDS> words{};
+
+        [[nodiscard]] bool test(unsigned day_of_year) const noexcept {
+            return ((words[day_of_year / 64] >> (day_of_year % 64)) & 1U) != 0;
+        }
+
+        void set(unsigned day_of_year) noexcept {
+            words[day_of_year / 64] |= std::uint64_t{1} << (day_of_year % 64);
+        }
+    };
+
+    /**
+     * @brief Bitmaps of a block of consecutive years, each one published by its ready flag
+     *
+     * A bitmap is written once, under cache_mutex_, before its flag is set with release
+     * semantics; a reader that sees the flag set with acquire semantics sees the whole bitmap.
+     */
+    struct YearChunk {
+        static constexpr int YEARS = 256;
+
+        std::array<YearBitmap, YEARS> bitmaps{};
+        std::array<std::atomic<bool>, YEARS> ready{};
+    };
+
+    // Chunks covering every year of std::chrono::year, from its first year on
+    static constexpr int FIRST_CACHED_YEAR = static_cast<int>(std::chrono::year::min());
+    static constexpr int LAST_CACHED_YEAR = static_cast<int>(std::chrono::year::max());
+    static constexpr std::size_t YEAR_CHUNKS =
+        (LAST_CACHED_YEAR - FIRST_CACHED_YEAR + YearChunk::YEARS) / YearChunk::YEARS;
+
+    /**
+     * @brief Get the holiday bitmap of a year, materializing it on first access
+     *
+     * Lock-free once the year has been built. Years outside the range of std::chrono::year
+     * contain no valid date and get an empty bitmap.
+     */
+    [[nodiscard]] const YearBitmap& yearBitmap(int year) const;
+
+    /**
+     * @brief Build and publish the bitmap of a year that is not yet materialized
+     */
+    [[nodiscard]] const YearBitmap& materializeYear(int year) const;
+
+    /**
+     * @brief Evaluate every rule for a year into a fresh bitmap
+     */
+    [[nodiscard]] YearBitmap buildYearBitmap(int year) const;
+
+    /**
+     * @brief Call visit(date, rule) for every holiday that the rules generate in a year
+     *
+     * Observed rules are resolved together with the neighbouring years, see ObservedRule.
+     */
+    template <typename Visitor>
+    void forEachRuleHoliday(int year, Visitor&& visit) const;
+
+    /**
+     * @brief Discard all materialized years and the shared snapshot (called whenever the rules
+     * change)
+     */
+    void invalidateCache() noexcept;
+
+    /**
+     * @brief Take over the materialized years and the shared snapshot of a calendar being moved
+     * from
+     */
+    void adoptCache(HolidayCalendar& other) noexcept;
+
+    std::vector<detail::StoredRule> rules_;
+    // Sorted by date; equal dates keep their insertion order
+    std::vector<detail::ExplicitHoliday> explicit_holidays_;
+
+    // Lazily materialized years. Chunks are never moved, so references handed out by
+    // yearBitmap() stay valid until the next invalidateCache(). The mutex serializes building;
+    // year_chunks_ publishes the chunks owned by chunk_storage_ to lock-free readers.
+    mutable std::mutex cache_mutex_;
+    mutable std::vector<std::unique_ptr<YearChunk>> chunk_storage_;
+    mutable std::array<std::atomic<YearChunk*>, YEAR_CHUNKS> year_chunks_{};
+
+    // Snapshot kept by compileShared() and its weekend, guarded by cache_mutex_
+    mutable std::shared_ptr<const CompiledCalendar> shared_compiled_;
+    mutable WeekendMask shared_weekend_;
 };
 
 } // namespace datelib
@@ -1,7 +1,12 @@
 #pragma once
 
+#include "datelib/date_util.h"
+#include "datelib/error.h"
+
 #include <chrono>
+#include <expected>
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace datelib {
@@ -11,6 +16,16 @@ namespace datelib {
  */
 enum class Occurrence { First = 1, Second = 2, Third = 3, Fourth = 4, Fifth = 5, Last = -1 };
 
+/**
+ * @brief First year covered by the Easter rules (the first full year of the Gregorian calendar)
+ */
+inline constexpr int EASTER_FIRST_YEAR = 1583;
+
+/**
+ * @brief Last year covered by the Easter rules
+ */
+inline constexpr int EASTER_LAST_YEAR = 4099;
+
 /**
  * @brief Abstract base class for holiday calculation rules
  */
@@ -34,6 +49,19 @@ class HolidayRule {
      */
     [[nodiscard]] virtual std::chrono::year_month_day calculateDate(int year) const = 0;
 
+    /**
+     * @brief Calculate the holiday date for a given year, if the rule applies to that year
+     * @param year The year to calculate the holiday for
+     * @return The date of the holiday, or std::nullopt if the rule does not apply to that year
+     *
+     * Evaluates the rule once where appliesTo() followed by calculateDate() evaluates it twice,
+     * and never throws for a year the rule does not apply to; HolidayCalendar only uses this.
+     * The default implementation makes exactly those two calls, so existing rules keep working.
+     * The built-in rules override it and implement appliesTo() and calculateDate() on top of it;
+     * a subclass of a built-in rule is still evaluated through its own overrides of those two.
+     */
+    [[nodiscard]] virtual std::optional<std::chrono::year_month_day> tryDate(int year) const;
+
     /**
      * @brief Get the name of this holiday
      * @return The holiday name
@@ -69,7 +97,7 @@ class HolidayRule {
  *
  * When calculateDate(year) is called:
  * - If year matches the stored date's year, returns the date
- * - Otherwise throws std::runtime_error (caught by HolidayCalendar methods)
+ * - Otherwise throws DateNotInYearException (tryDate() returns std::nullopt instead)
  */
 class ExplicitDateRule : public HolidayRule {
   public:
@@ -89,10 +117,21 @@ class ExplicitDateRule : public HolidayRule {
      */
     [[nodiscard]] bool appliesTo(int year) const override;
     [[nodiscard]] std::chrono::year_month_day calculateDate(int year) const override;
+    [[nodiscard]] std::optional<std::chrono::year_month_day> tryDate(int year) const override;
     [[nodiscard]] std::string getName() const override { return name_; }
     [[nodiscard]] std::unique_ptr<HolidayRule> clone() const override;
 
+    /**
+     * @brief Get the date of this holiday
+     */
+    [[nodiscard]] std::chrono::year_month_day date() const { return date_; }
+
   private:
+    /**
+     * @brief Evaluate the rule once, without virtual calls
+     */
+    [[nodiscard]] std::optional<std::chrono::year_month_day> dateIn(int year) const;
+
     std::string name_;
     std::chrono::year_month_day date_;
 };
@@ -113,10 +152,16 @@ class FixedDateRule : public HolidayRule {
 
     [[nodiscard]] bool appliesTo(int year) const override;
     [[nodiscard]] std::chrono::year_month_day calculateDate(int year) const override;
+    [[nodiscard]] std::optional<std::chrono::year_month_day> tryDate(int year) const override;
     [[nodiscard]] std::string getName() const override { return name_; }
     [[nodiscard]] std::unique_ptr<HolidayRule> clone() const override;
 
   private:
+    /**
+     * @brief Evaluate the rule once, without virtual calls
+     */
+    [[nodiscard]] std::optional<std::chrono::year_month_day> dateIn(int year) const;
+
     std::string name_;
     std::chrono::month month_;
     std::chrono::day day_;
@@ -140,14 +185,212 @@ class NthWeekdayRule : public HolidayRule {
 
     [[nodiscard]] bool appliesTo(int year) const override;
     [[nodiscard]] std::chrono::year_month_day calculateDate(int year) const override;
+    [[nodiscard]] std::optional<std::chrono::year_month_day> tryDate(int year) const override;
     [[nodiscard]] std::string getName() const override { return name_; }
     [[nodiscard]] std::unique_ptr<HolidayRule> clone() const override;
 
+    /**
+     * @brief Calculate the holiday date for a given year without throwing
+     * @param year The year to calculate for
+     * @return The date, or ErrorCode::OccurrenceNotFound if the month has no such occurrence
+     */
+    [[nodiscard]] std::expected<std::chrono::year_month_day, Error>
+    tryCalculateDate(int year) const noexcept;
+
   private:
+    /**
+     * @brief Evaluate the rule once, without virtual calls
+     */
+    [[nodiscard]] std::optional<std::chrono::year_month_day> dateIn(int year) const;
+
     std::string name_;
     std::chrono::month month_;
     std::chrono::weekday weekday_;
     Occurrence occurrence_;
 };
 
+/**
+ * @brief Rule for holidays at a fixed offset from Western (Gregorian) Easter Sunday
+ * Example: Good Friday (-2), Easter Monday (+1), Ascension Day (+39), Whit Monday (+50)
+ *
+ * Easter dates come from a table computed at compile time for the years EASTER_FIRST_YEAR to
+ * EASTER_LAST_YEAR and shared by every rule, so evaluating a rule is a lookup rather than a
+ * computus. The rule does not apply to years outside that range, nor to years where the offset
+ * moves the date into another year.
+ */
+class EasterRule : public HolidayRule {
+  public:
+    /**
+     * @brief Construct an Easter-based holiday rule
+     * @param name The name of the holiday
+     * @param offset_days Days from Easter Sunday to the holiday (negative for earlier dates)
+     */
+    explicit EasterRule(std::string name, int offset_days = 0);
+
+    [[nodiscard]] bool appliesTo(int year) const override;
+    [[nodiscard]] std::chrono::year_month_day calculateDate(int year) const override;
+    [[nodiscard]] std::optional<std::chrono::year_month_day> tryDate(int year) const override;
+    [[nodiscard]] std::string getName() const override { return name_; }
+    [[nodiscard]] std::unique_ptr<HolidayRule> clone() const override;
+
+    /**
+     * @brief Get the date of Easter Sunday
+     * @param year The year, between EASTER_FIRST_YEAR and EASTER_LAST_YEAR
+     * @return Easter Sunday of that year
+     * @throws DateNotInYearException if the year is outside the supported range
+     */
+    [[nodiscard]] static std::chrono::year_month_day easterSunday(int year);
+
+  private:
+    /**
+     * @brief Evaluate the rule once, without virtual calls
+     */
+    [[nodiscard]] std::optional<std::chrono::year_month_day> dateIn(int year) const;
+
+    std::string name_;
+    int offset_days_;
+};
+
+/**
+ * @brief Rule for holidays at a fixed offset from the date of another rule
+ * Example: the day after Thanksgiving, OffsetFromRule("Black Friday", thanksgiving, 1)
+ *
+ * The holiday of a year is the base rule's date of that year moved by the offset. The rule does
+ * not apply to years where the base rule does not, nor to years where the offset moves the date
+ * into another year.
+ */
+class OffsetFromRule : public HolidayRule {
+  public:
+    /**
+     * @brief Construct an offset holiday rule
+     * @param name The name of the holiday
+     * @param base The rule the offset is taken from (ownership is transferred)
+     * @param offset_days Days from the base rule's date to the holiday
+     * @throws std::invalid_argument if base is null
+     */
+    OffsetFromRule(std::string name, std::unique_ptr<HolidayRule> base, int offset_days);
+
+    OffsetFromRule(const OffsetFromRule& other);
+    OffsetFromRule& operator=(const OffsetFromRule& other);
+    OffsetFromRule(OffsetFromRule&& other) noexcept = default;
+    OffsetFromRule& operator=(OffsetFromRule&& other) noexcept = default;
+    ~OffsetFromRule() override = default;
+
+    [[nodiscard]] bool appliesTo(int year) const override;
+    [[nodiscard]] std::chrono::year_month_day calculateDate(int year) const override;
+    [[nodiscard]] std::optional<std::chrono::year_month_day> tryDate(int year) const override;
+    [[nodiscard]] std::string getName() const override { return name_; }
+    [[nodiscard]] std::unique_ptr<HolidayRule> clone() const override;
+
+  private:
+    /**
+     * @brief Evaluate the rule once, without virtual calls
+     */
+    [[nodiscard]] std::optional<std::chrono::year_month_day> dateIn(int year) const;
+
+    std::string name_;
+    std::unique_ptr<HolidayRule> base_;
+    int offset_days_;
+};
+
+/**
+ * @brief How a holiday falling on a weekend day is observed
+ */
+enum class Observance {
+    /**
+     * @brief Move to the closest weekday, the following one on a tie
+     *
+     * With a Saturday and Sunday weekend, Saturday moves to Friday and Sunday to Monday (US
+     * federal holidays).
+     */
+    NearestWeekday,
+
+    /**
+     * @brief Move to the first weekday after, even if it is already a holiday
+     */
+    NextMonday,
+
+    /**
+     * @brief Move to the first weekday after that is not already a holiday
+     *
+     * Substitutes chain: with Christmas on Saturday and Boxing Day on Sunday, Christmas is
+     * observed on Monday and Boxing Day on Tuesday (UK bank holidays).
+     */
+    Substitute
+};
+
+/**
+ * @brief Rule observing another rule's holiday on a weekday when it falls on a weekend day
+ * Example: ObservedRule("Independence Day", fixed_july_4, Observance::NearestWeekday)
+ *
+ * The holiday is the observed date only; the actual weekend date is not a holiday of this rule.
+ * The observed date may fall in the year before or after the actual date (New Year's Day on a
+ * Saturday observed on December 31), and HolidayCalendar assigns it to the observed year.
+ *
+ * On its own, calculateDate() applies the observance without knowing other holidays, so the
+ * Substitute policy behaves like NextMonday. HolidayCalendar resolves substitutes against all
+ * its holidays when it builds a year: the actual weekday dates of every rule are placed first,
+ * then the substitutes in the order of their actual dates (rules added earlier first on the same
+ * date), so the result depends neither on query order nor on the order rules were added in.
+ */
+class ObservedRule : public HolidayRule {
+  public:
+    /**
+     * @brief Construct an observed holiday rule
+     * @param name The name of the holiday
+     * @param rule The rule giving the actual date (ownership is transferred)
+     * @param observance How a date on a weekend day is observed
+     * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+     * @throws std::invalid_argument if rule is null
+     */
+    ObservedRule(std::string name, std::unique_ptr<HolidayRule> rule, Observance observance,
+                 WeekendMask weekend = WeekendMask::saturdaySunday());
+
+    ObservedRule(const ObservedRule& other);
+    ObservedRule& operator=(const ObservedRule& other);
+    ObservedRule(ObservedRule&& other) noexcept = default;
+    ObservedRule& operator=(ObservedRule&& other) noexcept = default;
+    ~ObservedRule() override = default;
+
+    [[nodiscard]] bool appliesTo(int year) const override;
+    [[nodiscard]] std::chrono::year_month_day calculateDate(int year) const override;
+    [[nodiscard]] std::optional<std::chrono::year_month_day> tryDate(int year) const override;
+    [[nodiscard]] std::string getName() const override { return name_; }
+    [[nodiscard]] std::unique_ptr<HolidayRule> clone() const override;
+
+    /**
+     * @brief Get the actual (unobserved) date of a year
+     * @param year The year of the actual date
+     * @return The wrapped rule's date, or std::nullopt if that rule does not apply to the year
+     */
+    [[nodiscard]] std::optional<std::chrono::year_month_day> actualDate(int year) const;
+
+    /**
+     * @brief Get the observance policy
+     */
+    [[nodiscard]] Observance observance() const noexcept { return observance_; }
+
+    /**
+     * @brief Get the weekdays considered as weekend
+     */
+    [[nodiscard]] WeekendMask weekend() const noexcept { return weekend_; }
+
+  private:
+    /**
+     * @brief Evaluate the rule once, without virtual calls
+     */
+    [[nodiscard]] std::optional<std::chrono::year_month_day> dateIn(int year) const;
+
+    /**
+     * @brief Apply the observance to an actual date, without knowledge of other holidays
+     */
+    [[nodiscard]] std::chrono::year_month_day
+    observe(const std::chrono::year_month_day& date) const;
+
+    std::string name_;
+    std::unique_ptr<HolidayRule> rule_;
+    Observance observance_;
+    WeekendMask weekend_;
+};
+
 } // namespace datelib
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "datelib/BusinessDate.h"
+#include "datelib/HolidayCalendar.h"
+#include "datelib/date.h"
+#include "datelib/date_util.h"
+#include "datelib/error.h"
+#include "datelib/period.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <vector>
+
+namespace datelib {
+
+/**
+ * @brief How the holidays of the calendars of a JointCalendar are combined
+ */
+enum class JoinRule {
+    /**
+     * @brief A day is a holiday if it is a holiday in any calendar, so a business day must be a
+     * business day in all of them (e.g. settlement in both New York and London)
+     */
+    JoinHolidays,
+
+    /**
+     * @brief A day is a holiday only if it is a holiday in every calendar, so a business day
+     * needs to be a business day in one of them
+     */
+    JoinBusinessDays
+};
+
+/**
+ * @brief Holiday calendar combining several HolidayCalendar objects under a JoinRule
+ *
+ * A JointCalendar refers to its calendars without copying their rules. Queries combine the
+ * per-year holiday bitmaps of the calendars word by word (OR for JoinHolidays, AND for
+ * JoinBusinessDays) and the business day searches of adjust() and advance() scan the combined
+ * bitmap, so every calendar is consulted once per year touched rather than once per day.
+ *
+ * Nothing is cached by the joint calendar itself: rules added to one of the calendars are seen
+ * by the next query. The calendars must outlive the JointCalendar.
+ *
+ * Example usage:
+ * @code
+ *   const JointCalendar settlement({new_york, london});
+ *   settlement.adjust(date, BusinessDayConvention::ModifiedFollowing);
+ * @endcode
+ */
+class JointCalendar {
+  public:
+    /**
+     * @brief Construct a joint calendar
+     * @param calendars The calendars to combine
+     * @param rule How their holidays are combined
+     * @throws std::invalid_argument if calendars is empty
+     */
+    explicit JointCalendar(std::vector<std::reference_wrapper<const HolidayCalendar>> calendars,
+                           JoinRule rule = JoinRule::JoinHolidays);
+
+    /**
+     * @brief Get the rule combining the holidays of the calendars
+     */
+    [[nodiscard]] JoinRule joinRule() const noexcept { return rule_; }
+
+    /**
+     * @brief Get the number of calendars combined
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return calendars_.size(); }
+
+    /**
+     * @brief Check if a given date is a holiday of the joint calendar
+     * @param date The date to check
+     * @return true if the date is a holiday under the join rule, false otherwise (including for
+     * an invalid date)
+     */
+    [[nodiscard]] bool isHoliday(const std::chrono::year_month_day& date) const;
+
+    /**
+     * @brief Check if a given serial date is a holiday of the joint calendar
+     */
+    [[nodiscard]] bool isHoliday(BusinessDate date) const;
+
+    /**
+     * @brief Get all holidays of the joint calendar for a given year
+     * @param year The year to get holidays for
+     * @return A sorted vector of all holiday dates in that year
+     */
+    [[nodiscard]] std::vector<std::chrono::year_month_day> getHolidays(int year) const;
+
+    /**
+     * @brief Check if a given date is a business day
+     * @param date The date to check
+     * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+     * @return true if the date is not a weekend day and not a holiday of the joint calendar
+     * @throws std::invalid_argument if the date is invalid
+     */
+    [[nodiscard]] bool isBusinessDay(const std::chrono::year_month_day& date,
+                                     WeekendMask weekend = WeekendMask::saturdaySunday()) const;
+
+    /**
+     * @brief Check if a given serial date is a business day
+     */
+    [[nodiscard]] bool isBusinessDay(BusinessDate date,
+                                     WeekendMask weekend = WeekendMask::saturdaySunday()) const;
+
+    /**
+     * @brief Adjust a date according to a business day convention
+     * @param date The date to adjust
+     * @param convention The business day convention to apply
+     * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+     * @return The adjusted date, with the same semantics as datelib::adjust()
+     * @throws std::invalid_argument if the input date is invalid
+     * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+     */
+    [[nodiscard]] std::chrono::year_month_day
+    adjust(const std::chrono::year_month_day& date, BusinessDayConvention convention,
+           WeekendMask weekend = WeekendMask::saturdaySunday()) const;
+
+    /**
+     * @brief Adjust a serial date according to a business day convention
+     * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+     */
+    [[nodiscard]] BusinessDate adjust(BusinessDate date, BusinessDayConvention convention,
+                                      WeekendMask weekend = WeekendMask::saturdaySunday()) const;
+
+    /**
+     * @brief Advance a date by a period and adjust according to business day convention
+     * @param date The starting date
+     * @param period The period to advance
+     * @param convention The business day convention to apply after advancing
+     * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+     * @return The advanced and adjusted date, with the same semantics as datelib::advance()
+     * @throws InvalidDateException if the input date is invalid
+     * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+     */
+    [[nodiscard]] std::chrono::year_month_day
+    advance(const std::chrono::year_month_day& date, const Period& period,
+            BusinessDayConvention convention,
+            WeekendMask weekend = WeekendMask::saturdaySunday()) const;
+
+    /**
+     * @brief Advance a serial date by a period and adjust according to business day convention
+     * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+     */
+    [[nodiscard]] BusinessDate advance(BusinessDate date, const Period& period,
+                                       BusinessDayConvention convention,
+                                       WeekendMask weekend = WeekendMask::saturdaySunday()) const;
+
+  private:
+    /**
+     * @brief Non-business days of one year, one bit per day of the year (bit 0 is January 1)
+     *
+     * Bits past the end of the year are set, so that scans never stop there.
+     */
+    struct ClosedDays {
+        int year;
+        BusinessDate first_day;
+        HolidayCalendar::YearBitmap bits;
+    };
+
+    /**
+     * @brief Combine one word of the calendars' holiday bitmaps of a year
+     */
+    [[nodiscard]] std::uint64_t holidayWord(int year, std::size_t word_index) const;
+
+    /**
+     * @brief Combine the calendars' holiday bitmaps of a year
+     */
+    [[nodiscard]] HolidayCalendar::YearBitmap holidays(int year) const;
+
+    /**
+     * @brief Make sure closed covers the year of date, rebuilding it if needed
+     */
+    void loadYear(ClosedDays& closed, BusinessDate date, WeekendMask weekend) const;
+
+    /**
+     * @brief First business day in [from, from + max_days], scanning the combined bitmaps
+     */
+    [[nodiscard]] std::expected<BusinessDate, Error>
+    nextBusinessDay(BusinessDate from, int max_days, ClosedDays& closed, WeekendMask weekend,
+                    ErrorCode not_found) const;
+
+    /**
+     * @brief Last business day in [from - max_days, from], scanning the combined bitmaps
+     */
+    [[nodiscard]] std::expected<BusinessDate, Error>
+    previousBusinessDay(BusinessDate from, int max_days, ClosedDays& closed, WeekendMask weekend,
+                        ErrorCode not_found) const;
+
+    [[nodiscard]] std::expected<BusinessDate, Error>
+    tryAdjustSerial(BusinessDate date, BusinessDayConvention convention,
+                    WeekendMask weekend) const;
+
+    [[nodiscard]] std::expected<BusinessDate, Error>
+    tryAdvanceSerial(BusinessDate date, const Period& period, BusinessDayConvention convention,
+                     WeekendMask weekend) const;
+
+    std::vector<const HolidayCalendar*> calendars_;
+    JoinRule rule_;
+};
+
+} // namespace datelib
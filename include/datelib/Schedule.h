@@ -0,0 +1,172 @@
+#pragma once
+
+#include "datelib/CompiledCalendar.h"
+#include "datelib/date.h"
+#include "datelib/date_util.h"
+#include "datelib/period.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace datelib {
+
+class HolidayCalendar;
+
+namespace detail {
+struct CalendarAnchor;
+} // namespace detail
+
+/**
+ * @brief Direction in which the regular roll dates of a schedule are generated
+ */
+enum class DateGeneration {
+    /**
+     * @brief Roll forward from the effective date; any stub is at the back
+     */
+    Forward,
+
+    /**
+     * @brief Roll backward from the termination date; any stub is at the front
+     */
+    Backward
+};
+
+/**
+ * @brief How a period that does not fit the tenor is handled
+ */
+enum class StubType {
+    /**
+     * @brief Keep the remainder as its own period, shorter than the tenor
+     */
+    Short,
+
+    /**
+     * @brief Merge the remainder into the neighbouring regular period, longer than the tenor
+     */
+    Long
+};
+
+/**
+ * @brief Generator of the period dates of a coupon schedule
+ *
+ * A schedule runs from an effective date to a termination date in steps of a tenor. Roll dates
+ * are generated from one end (see DateGeneration) as multiples of the tenor from that end, so
+ * that clamped month ends (e.g. Feb 28) do not drift into the following dates. When the range is
+ * not a whole number of tenors, the remainder becomes a short or long stub at the other end.
+ *
+ * With the end-of-month roll, a schedule whose generation anchor (the effective date when
+ * rolling forward, the termination date when rolling backward) is the last day of its month
+ * rolls on month ends for month and year tenors: 2024-02-29 + 1M = 2024-03-31.
+ *
+ * A Schedule only stores its parameters; generate() writes the dates into caller-provided
+ * storage, so building many schedules does not allocate. Each date is adjusted once.
+ *
+ * Example usage:
+ * @code
+ *   const Schedule schedule(2024y / March / 15, 2029y / March / 15, Period::parse("6M"),
+ *                           BusinessDayConvention::ModifiedFollowing);
+ *   std::vector<year_month_day> unadjusted(schedule.size()), adjusted(schedule.size());
+ *   schedule.generate(unadjusted, adjusted, calendar);
+ * @endcode
+ */
+class Schedule {
+  public:
+    /**
+     * @brief Construct a schedule
+     * @param effective The start date of the first period
+     * @param termination The end date of the last period
+     * @param tenor The length of the regular periods, in weeks, months or years
+     * @param convention The business day convention used to adjust every date
+     * @param generation The direction of generation (defaults to Backward)
+     * @param stub How a remainder period is handled (defaults to Short)
+     * @param end_of_month Whether to roll on month ends from a month-end anchor
+     * @throws InvalidDateException if the effective or the termination date is invalid
+     * @throws std::invalid_argument if the termination date is not after the effective date, or
+     * if the tenor is not a positive number of weeks, months or years
+     */
+    Schedule(const std::chrono::year_month_day& effective,
+             const std::chrono::year_month_day& termination, const Period& tenor,
+             BusinessDayConvention convention, DateGeneration generation = DateGeneration::Backward,
+             StubType stub = StubType::Short, bool end_of_month = false);
+
+    /**
+     * @brief Get the number of dates in the schedule (the number of periods plus one)
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    /**
+     * @brief Check whether the schedule has a period that differs from the tenor
+     */
+    [[nodiscard]] bool hasStub() const noexcept { return has_stub_; }
+
+    /**
+     * @brief Write the unadjusted dates of the schedule
+     * @param unadjusted Receives the dates, in increasing order; must hold at least size() dates
+     * @return The number of dates written, size()
+     * @throws std::invalid_argument if the output span is too small
+     */
+    std::size_t generate(std::span<std::chrono::year_month_day> unadjusted) const;
+
+    /**
+     * @brief Write the unadjusted and adjusted dates of the schedule
+     * @param unadjusted Receives the unadjusted dates; must hold at least size() dates
+     * @param adjusted Receives the dates adjusted with the schedule's convention; must hold at
+     * least size() dates
+     * @param calendar The holiday calendar to use for adjustment
+     * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+     * @return The number of dates written, size()
+     * @throws std::invalid_argument if an output span is too small
+     * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+     */
+    std::size_t generate(std::span<std::chrono::year_month_day> unadjusted,
+                         std::span<std::chrono::year_month_day> adjusted,
+                         const HolidayCalendar& calendar,
+                         WeekendMask weekend = WeekendMask::saturdaySunday()) const;
+
+    /**
+     * @brief Write the unadjusted and adjusted dates of the schedule using a compiled calendar
+     * @param unadjusted Receives the unadjusted dates; must hold at least size() dates
+     * @param adjusted Receives the dates adjusted with the schedule's convention; must hold at
+     * least size() dates
+     * @param calendar The compiled calendar to use for adjustment
+     * @return The number of dates written, size()
+     * @throws std::invalid_argument if an output span is too small
+     * @throws DateOutOfRangeException if a date is outside the compiled range
+     * @throws BusinessDaySearchException if a search leaves the compiled range
+     */
+    std::size_t generate(std::span<std::chrono::year_month_day> unadjusted,
+                         std::span<std::chrono::year_month_day> adjusted,
+                         const CompiledCalendar& calendar) const;
+
+  private:
+    /**
+     * @brief The kth roll date from the generation anchor (k = 0 is the anchor itself)
+     */
+    [[nodiscard]] std::chrono::year_month_day rollDate(const detail::CalendarAnchor& anchor,
+                                                       std::int64_t k) const;
+
+    /**
+     * @brief Whether a roll date lies strictly between the anchor side and the opposite end
+     */
+    [[nodiscard]] bool beforeFarEnd(const std::chrono::year_month_day& date) const;
+
+    /**
+     * @brief Largest k whose roll date lies strictly before the opposite end
+     */
+    [[nodiscard]] std::int64_t countRegularSteps(const detail::CalendarAnchor& anchor) const;
+
+    std::chrono::year_month_day effective_;
+    std::chrono::year_month_day termination_;
+    Period tenor_;
+    BusinessDayConvention convention_;
+    DateGeneration generation_;
+    bool end_of_month_roll_;
+    // Roll dates generated from the anchor, including the anchor itself
+    std::size_t rolls_;
+    std::size_t size_;
+    bool has_stub_;
+};
+
+} // namespace datelib
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "datelib/error.h"
+#include "datelib/period.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <string_view>
+
+namespace datelib {
+
+/**
+ * @brief Table of interned tenor strings resolving to their parsed Period
+ *
+ * Feeds that carry tenors as text repeat the same few strings ("1M", "3M", "6M", "1Y") millions
+ * of times. A TenorCache parses each distinct string once and then answers with a single hash
+ * probe on the string's bytes, without re-validating it.
+ *
+ * The table has a fixed capacity and lives inside the object: it never allocates. Strings of up
+ * to MAX_KEY_LENGTH characters are interned, up to MAX_ENTRIES of them; anything else is parsed
+ * on every call, with the same result. Invalid strings are never interned.
+ *
+ * Resolving interns new strings, so a cache must not be shared between threads without
+ * synchronization; use one cache per thread.
+ *
+ * Example usage:
+ * @code
+ *   TenorCache tenors;
+ *   for (const auto& row : rows) {
+ *       const auto maturity = advance(row.date, tenors.resolve(row.tenor), convention, calendar);
+ *   }
+ * @endcode
+ */
+class TenorCache {
+  public:
+    /**
+     * @brief Longest tenor string that is interned
+     */
+    static constexpr std::size_t MAX_KEY_LENGTH = 7;
+
+    /**
+     * @brief Number of distinct tenor strings that can be interned
+     */
+    static constexpr std::size_t MAX_ENTRIES = 48;
+
+    /**
+     * @brief Construct an empty cache
+     */
+    TenorCache() noexcept = default;
+
+    /**
+     * @brief Resolve a tenor string to a Period without throwing
+     * @param period_str String representation of the period, in the formats accepted by
+     * Period::parse()
+     * @return The Period, or the Error of Period::tryParse()
+     */
+    [[nodiscard]] std::expected<Period, Error>
+    tryResolve(const std::string_view period_str) noexcept {
+        if (period_str.empty() || period_str.size() > MAX_KEY_LENGTH) {
+            return Period::tryParse(period_str);
+        }
+
+        const std::uint64_t key = packKey(period_str);
+        const auto length = static_cast<std::uint8_t>(period_str.size());
+        for (std::size_t slot = slotOf(key, length);; slot = (slot + 1) % SLOTS) {
+            const Entry& entry = entries_[slot];
+            if (entry.key == key && entry.length == length) {
+                return Period(entry.value, static_cast<Period::Unit>(entry.unit));
+            }
+            if (entry.length == 0) {
+                return intern(period_str, key, slot);
+            }
+        }
+    }
+
+    /**
+     * @brief Resolve a tenor string to a Period
+     * @param period_str String representation of the period, in the formats accepted by
+     * Period::parse()
+     * @return The Period
+     * @throws std::invalid_argument if the string is not a valid period, as Period::parse()
+     */
+    [[nodiscard]] Period resolve(std::string_view period_str);
+
+    /**
+     * @brief Get the number of interned tenor strings
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+  private:
+    struct Entry {
+        std::uint64_t key;
+        std::int32_t value;
+        std::uint8_t unit;
+        // Length of the interned string; 0 marks a free slot
+        std::uint8_t length;
+    };
+
+    // Open addressing table kept at most three quarters full, so probes stay short
+    static constexpr std::size_t SLOTS = 64;
+
+    /**
+     * @brief Pack the bytes of a 1 to 7 character string into a key
+     *
+     * Short strings take their first, middle and last byte; longer ones their first and last four
+     * bytes, which overlap. Together with the length, the key identifies the string, and building
+     * it takes two loads instead of a loop over the characters.
+     */
+    static std::uint64_t packKey(const std::string_view period_str) noexcept {
+        const auto* const bytes = reinterpret_cast<const unsigned char*>(period_str.data());
+        const std::size_t length = period_str.size();
+        if (length >= 4) {
+            std::uint32_t head = 0;
+            std::uint32_t tail = 0;
+            std::memcpy(&head, bytes, sizeof(head));
+            std::memcpy(&tail, bytes + length - sizeof(tail), sizeof(tail));
+            return (std::uint64_t{tail} << 32) | head;
+        }
+        return std::uint64_t{bytes[0]} | (std::uint64_t{bytes[length / 2]} << 8) |
+               (std::uint64_t{bytes[length - 1]} << 16);
+    }
+
+    /**
+     * @brief Home slot of a key (Fibonacci hashing)
+     */
+    static std::size_t slotOf(const std::uint64_t key, const std::uint8_t length) noexcept {
+        return static_cast<std::size_t>(((key ^ length) * 0x9E3779B97F4A7C15ULL) >> 58);
+    }
+
+    /**
+     * @brief Parse a string that is not in the table and intern it into a free slot
+     */
+    std::expected<Period, Error> intern(std::string_view period_str, std::uint64_t key,
+                                        std::size_t slot) noexcept;
+
+    std::array<Entry, SLOTS> entries_{};
+    std::size_t size_ = 0;
+};
+
+} // namespace datelib
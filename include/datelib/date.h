@@ -1,12 +1,18 @@
 #pragma once
 
+#include "datelib/BusinessDate.h"
 #include "datelib/date_util.h"
+#include "datelib/error.h"
 #include "datelib/exceptions.h"
 #include "datelib/period.h"
 
 #include <chrono>
+#include <cstdint>
+#include <expected>
+#include <span>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 namespace datelib {
 
@@ -42,28 +48,83 @@ enum class BusinessDayConvention {
     /**
      * @brief Do not adjust the date (return as-is)
      */
-    Unadjusted
+    Unadjusted,
+
+    /**
+     * @brief Move to the nearest business day, forward when the previous and the next business
+     * days are equally far
+     */
+    Nearest,
+
+    /**
+     * @brief Move forward to the next business day, unless it crosses into a new month or past
+     * the 15th of the month, in which case move backward to the previous business day
+     */
+    HalfMonthModifiedFollowing
 };
 
 /**
  * @brief Check if a given date is a business day
  * @param date The date to check
  * @param calendar The holiday calendar to use for checking holidays
- * @param weekend_days The set of weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @return true if the date is not a weekend day and not a holiday, false otherwise
+ * @throws std::invalid_argument if the date is invalid (e.g., February 30th)
+ */
+[[nodiscard]] bool isBusinessDay(const std::chrono::year_month_day& date,
+                                 const HolidayCalendar& calendar,
+                                 WeekendMask weekend = WeekendMask::saturdaySunday());
+
+/**
+ * @brief Check if a given serial date is a business day
+ * @param date The date to check
+ * @param calendar The holiday calendar to use for checking holidays
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @return true if the date is not a weekend day and not a holiday, false otherwise
+ *
+ * Every BusinessDate is a valid date, so no validation or year_month_day conversion happens.
+ */
+[[nodiscard]] bool isBusinessDay(BusinessDate date, const HolidayCalendar& calendar,
+                                 WeekendMask weekend = WeekendMask::saturdaySunday());
+
+/**
+ * @brief Check if a given date is a business day
+ * @param date The date to check
+ * @param calendar The holiday calendar to use for checking holidays
+ * @param weekend_days The set of weekdays considered as weekend
  * @return true if the date is not a weekend day and not a holiday, false otherwise
  * @throws std::invalid_argument if the date is invalid (e.g., February 30th)
+ * @note Kept for compatibility; the WeekendMask overload avoids building a hash set per call
  */
 [[nodiscard]] bool
 isBusinessDay(const std::chrono::year_month_day& date, const HolidayCalendar& calendar,
-              const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days = {
-                  std::chrono::Saturday, std::chrono::Sunday});
+              const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days);
+
+/**
+ * @brief Check whether each date of a batch is a business day
+ * @param dates The dates to check
+ * @param out Receives 1 for each business day and 0 for each other day; must have the same size
+ * as dates
+ * @param calendar The holiday calendar to use for checking holidays
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @throws std::invalid_argument if out and dates differ in size
+ *
+ * The dates are looked up with the vectorized kernel of CompiledCalendar::isBusinessDay(), in
+ * a snapshot of the years spanned by the batch that the calendar keeps for later batches (see
+ * HolidayCalendar::compileShared()). Batches spanning 200 years or more, such as one holding a
+ * 9999-12-31 sentinel, are looked up one date at a time instead. Callers that already hold a
+ * CompiledCalendar should use it directly.
+ */
+void isBusinessDay(std::span<const std::chrono::sys_days> dates, std::span<std::uint8_t> out,
+                   const HolidayCalendar& calendar,
+                   WeekendMask weekend = WeekendMask::saturdaySunday());
 
 /**
  * @brief Adjust a date according to a business day convention
  * @param date The date to adjust
  * @param convention The business day convention to apply
  * @param calendar The holiday calendar to use for checking business days
- * @param weekend_days The set of weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
  * @return The adjusted date according to the specified convention
  * @throws std::invalid_argument if the input date is invalid
  * @throws BusinessDaySearchException if unable to find a business day within reasonable range
@@ -76,12 +137,78 @@ isBusinessDay(const std::chrono::year_month_day& date, const HolidayCalendar& ca
  * - ModifiedPreceding: Moves to the previous business day unless it crosses into a new month;
  *   if it does, moves to the next business day
  * - Unadjusted: Returns the date unchanged
+ * - Nearest: Moves to the nearest business day, the next one when both are equally far
+ * - HalfMonthModifiedFollowing: As ModifiedFollowing, and also moves to the previous business day
+ *   when the next one is past the 15th while the date is not
+ */
+[[nodiscard]] std::chrono::year_month_day
+adjust(const std::chrono::year_month_day& date, BusinessDayConvention convention,
+       const HolidayCalendar& calendar, WeekendMask weekend = WeekendMask::saturdaySunday());
+
+/**
+ * @brief Adjust a date according to a business day convention, without throwing
+ * @param date The date to adjust
+ * @param convention The business day convention to apply
+ * @param calendar The holiday calendar to use for checking business days
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @return The adjusted date, or ErrorCode::InvalidDate, ErrorCode::NextBusinessDayNotFound,
+ * ErrorCode::PreviousBusinessDayNotFound, ErrorCode::NearestBusinessDayNotFound or
+ * ErrorCode::UnhandledConvention
+ *
+ * Same result as adjust() for valid input. Failures are returned rather than thrown, so that
+ * bulk pipelines can skip bad rows without unwinding; the error path does not allocate.
+ */
+[[nodiscard]] std::expected<std::chrono::year_month_day, Error>
+tryAdjust(const std::chrono::year_month_day& date, BusinessDayConvention convention,
+          const HolidayCalendar& calendar, WeekendMask weekend = WeekendMask::saturdaySunday());
+
+/**
+ * @brief Adjust a serial date according to a business day convention
+ * @param date The date to adjust
+ * @param convention The business day convention to apply
+ * @param calendar The holiday calendar to use for checking business days
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @return The adjusted date, with the same semantics as the year_month_day overload
+ * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+ */
+[[nodiscard]] BusinessDate adjust(BusinessDate date, BusinessDayConvention convention,
+                                  const HolidayCalendar& calendar,
+                                  WeekendMask weekend = WeekendMask::saturdaySunday());
+
+/**
+ * @brief Adjust a date according to a business day convention
+ * @param date The date to adjust
+ * @param convention The business day convention to apply
+ * @param calendar The holiday calendar to use for checking business days
+ * @param weekend_days The set of weekdays considered as weekend
+ * @return The adjusted date according to the specified convention
+ * @throws std::invalid_argument if the input date is invalid
+ * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+ * @note Kept for compatibility; the WeekendMask overload avoids building a hash set per call
  */
 [[nodiscard]] std::chrono::year_month_day
 adjust(const std::chrono::year_month_day& date, BusinessDayConvention convention,
        const HolidayCalendar& calendar,
-       const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days = {
-           std::chrono::Saturday, std::chrono::Sunday});
+       const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days);
+
+/**
+ * @brief Adjust each date of a batch according to a business day convention
+ * @param dates The dates to adjust
+ * @param out Receives the adjusted dates; must have the same size as dates and may be the same
+ * storage
+ * @param convention The business day convention to apply
+ * @param calendar The holiday calendar to use for checking business days
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @throws std::invalid_argument if out and dates differ in size
+ * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+ *
+ * Like the batch isBusinessDay(), this goes through a shared snapshot of the years spanned by
+ * the batch (plus one year on each side for searches that cross a year boundary), see
+ * CompiledCalendar::adjust(), or date by date for batches spanning 200 years or more.
+ */
+void adjust(std::span<const std::chrono::sys_days> dates, std::span<std::chrono::sys_days> out,
+            BusinessDayConvention convention, const HolidayCalendar& calendar,
+            WeekendMask weekend = WeekendMask::saturdaySunday());
 
 /**
  * @brief Advance a date by a period and adjust according to business day convention
@@ -89,7 +216,7 @@ adjust(const std::chrono::year_month_day& date, BusinessDayConvention convention
  * @param period The period to advance (e.g., "2W", "6M", "10Y")
  * @param convention The business day convention to apply after advancing
  * @param calendar The holiday calendar to use for business day adjustment
- * @param weekend_days The set of weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
  * @return The advanced and adjusted date
  * @throws std::invalid_argument if the period string is invalid
  * @throws InvalidDateException if the input date is invalid
@@ -104,12 +231,120 @@ adjust(const std::chrono::year_month_day& date, BusinessDayConvention convention
  * - advance(2024-01-15, "2W", Following, calendar) -> advances by 2 weeks then adjusts
  * - advance(2024-01-31, "1M", ModifiedFollowing, calendar) -> advances by 1 month then adjusts
  * - advance(2024-12-25, "1Y", Preceding, calendar) -> advances by 1 year then adjusts
+ *
+ * Business day periods ("500D") count whole 64-day words of the calendar's cached year bitmaps
+ * at once, so their cost grows with the number of words crossed, not with the number of days.
+ *
+ * The period string is parsed on every call. Callers that see the same tenor strings over and
+ * over can resolve them through a TenorCache and call the Period overload instead.
+ */
+[[nodiscard]] std::chrono::year_month_day
+advance(const std::chrono::year_month_day& date, std::string_view period,
+        BusinessDayConvention convention, const HolidayCalendar& calendar,
+        WeekendMask weekend = WeekendMask::saturdaySunday());
+
+/**
+ * @brief Advance a date by a period string and adjust according to business day convention
+ * @param date The starting date
+ * @param period The period to advance (e.g., "2W", "6M", "10Y")
+ * @param convention The business day convention to apply after advancing
+ * @param calendar The holiday calendar to use for business day adjustment
+ * @param weekend_days The set of weekdays considered as weekend
+ * @return The advanced and adjusted date
+ * @throws std::invalid_argument if the period string is invalid
+ * @throws InvalidDateException if the input date is invalid
+ * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+ * @note Kept for compatibility; the WeekendMask overload avoids building a hash set per call
  */
 [[nodiscard]] std::chrono::year_month_day
 advance(const std::chrono::year_month_day& date, std::string_view period,
         BusinessDayConvention convention, const HolidayCalendar& calendar,
-        const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days = {
-            std::chrono::Saturday, std::chrono::Sunday});
+        const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days);
+
+/**
+ * @brief Advance a date by a Period object and adjust according to business day convention
+ * @param date The starting date
+ * @param period The Period object representing the duration to advance
+ * @param convention The business day convention to apply after advancing
+ * @param calendar The holiday calendar to use for business day adjustment
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @return The advanced and adjusted date
+ * @throws InvalidDateException if the input date is invalid
+ * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+ */
+[[nodiscard]] std::chrono::year_month_day
+advance(const std::chrono::year_month_day& date, const Period& period,
+        BusinessDayConvention convention, const HolidayCalendar& calendar,
+        WeekendMask weekend = WeekendMask::saturdaySunday());
+
+/**
+ * @brief Advance a date by a Period object and adjust it, without throwing
+ * @param date The starting date
+ * @param period The Period object representing the duration to advance
+ * @param convention The business day convention to apply after advancing
+ * @param calendar The holiday calendar to use for business day adjustment
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @return The advanced and adjusted date, or ErrorCode::InvalidDate or a business day search
+ * error
+ *
+ * Same result as advance() for valid input; see tryAdjust().
+ */
+[[nodiscard]] std::expected<std::chrono::year_month_day, Error>
+tryAdvance(const std::chrono::year_month_day& date, const Period& period,
+           BusinessDayConvention convention, const HolidayCalendar& calendar,
+           WeekendMask weekend = WeekendMask::saturdaySunday());
+
+/**
+ * @brief Advance a date by a period string and adjust it, without throwing
+ * @param date The starting date
+ * @param period The period to advance (e.g., "2W", "6M", "10Y")
+ * @param convention The business day convention to apply after advancing
+ * @param calendar The holiday calendar to use for business day adjustment
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @return The advanced and adjusted date, or the error of Period::tryParse() or of the Period
+ * overload
+ */
+[[nodiscard]] std::expected<std::chrono::year_month_day, Error>
+tryAdvance(const std::chrono::year_month_day& date, std::string_view period,
+           BusinessDayConvention convention, const HolidayCalendar& calendar,
+           WeekendMask weekend = WeekendMask::saturdaySunday());
+
+/**
+ * @brief Advance a serial date by a Period object and adjust according to business day convention
+ * @param date The starting date
+ * @param period The Period object representing the duration to advance
+ * @param convention The business day convention to apply after advancing
+ * @param calendar The holiday calendar to use for business day adjustment
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @return The advanced and adjusted date, with the same semantics as the year_month_day overload
+ * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+ */
+[[nodiscard]] BusinessDate advance(BusinessDate date, const Period& period,
+                                   BusinessDayConvention convention,
+                                   const HolidayCalendar& calendar,
+                                   WeekendMask weekend = WeekendMask::saturdaySunday());
+
+/**
+ * @brief Advance one date by each period of a tenor grid and adjust the results
+ * @param anchor The starting date shared by all periods (e.g. the spot date of a curve)
+ * @param periods The periods to advance by, e.g. the pillars 1W, 1M, ..., 50Y
+ * @param convention The business day convention to apply after advancing
+ * @param calendar The holiday calendar to use for business day adjustment
+ * @param weekend The weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @return The advanced and adjusted dates, in the order of periods
+ * @throws InvalidDateException if the anchor is invalid
+ * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+ *
+ * Each result equals advance(anchor, periods[i], convention, calendar, weekend). The anchor is
+ * validated and decomposed into year, month and day once for the whole grid, and business day
+ * periods walk on from the previous pillar rather than from the anchor. When the same grid is
+ * used for many curves or scenarios, compiling the calendar once and calling
+ * CompiledCalendar::advance() also replaces the holiday lookups with bit tests.
+ */
+[[nodiscard]] std::vector<std::chrono::year_month_day>
+advance(const std::chrono::year_month_day& anchor, std::span<const Period> periods,
+        BusinessDayConvention convention, const HolidayCalendar& calendar,
+        WeekendMask weekend = WeekendMask::saturdaySunday());
 
 /**
  * @brief Advance a date by a Period object and adjust according to business day convention
@@ -117,15 +352,15 @@ advance(const std::chrono::year_month_day& date, std::string_view period,
  * @param period The Period object representing the duration to advance
  * @param convention The business day convention to apply after advancing
  * @param calendar The holiday calendar to use for business day adjustment
- * @param weekend_days The set of weekdays considered as weekend (defaults to Saturday and Sunday)
+ * @param weekend_days The set of weekdays considered as weekend
  * @return The advanced and adjusted date
  * @throws std::invalid_argument if the input date is invalid
  * @throws BusinessDaySearchException if unable to find a business day within reasonable range
+ * @note Kept for compatibility; the WeekendMask overload avoids building a hash set per call
  */
 [[nodiscard]] std::chrono::year_month_day
 advance(const std::chrono::year_month_day& date, const Period& period,
         BusinessDayConvention convention, const HolidayCalendar& calendar,
-        const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days = {
-            std::chrono::Saturday, std::chrono::Sunday});
+        const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days);
 
 } // namespace datelib
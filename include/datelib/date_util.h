@@ -1,6 +1,8 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <unordered_set>
 
 namespace datelib {
 
@@ -11,4 +13,82 @@ struct WeekdayHash {
     }
 };
 
+/**
+ * @brief Set of weekdays considered as weekend, stored as a 7-bit mask
+ *
+ * WeekendMask is a trivially copyable value type: building one never allocates and testing a
+ * weekday is a single shift. Bit N stands for the weekday whose C encoding is N (0 = Sunday).
+ *
+ * Example usage:
+ * @code
+ *   constexpr auto middle_east = WeekendMask::of(std::chrono::Friday, std::chrono::Saturday);
+ *   static_assert(middle_east.contains(std::chrono::Friday));
+ *   isBusinessDay(date, calendar, middle_east);
+ * @endcode
+ */
+class WeekendMask {
+  public:
+    /**
+     * @brief Construct a mask without any weekend day
+     */
+    constexpr WeekendMask() noexcept = default;
+
+    /**
+     * @brief Construct a mask from a set of weekdays
+     * @param weekend_days The weekdays considered as weekend
+     */
+    explicit WeekendMask(
+        const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) noexcept {
+        for (const auto& wd : weekend_days) {
+            add(wd);
+        }
+    }
+
+    /**
+     * @brief Build a mask from a list of weekdays
+     * @param weekend_days The weekdays considered as weekend
+     */
+    template <typename... Weekdays>
+    [[nodiscard]] static constexpr WeekendMask of(Weekdays... weekend_days) noexcept {
+        WeekendMask mask;
+        (mask.add(weekend_days), ...);
+        return mask;
+    }
+
+    /**
+     * @brief The usual Saturday and Sunday weekend
+     */
+    [[nodiscard]] static constexpr WeekendMask saturdaySunday() noexcept {
+        return of(std::chrono::Saturday, std::chrono::Sunday);
+    }
+
+    /**
+     * @brief Add a weekday to the weekend (invalid weekdays are ignored)
+     * @return This mask, to allow chaining
+     */
+    constexpr WeekendMask& add(const std::chrono::weekday wd) noexcept {
+        if (wd.ok()) {
+            bits_ = static_cast<std::uint8_t>(bits_ | (1U << wd.c_encoding()));
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Check whether a weekday is part of the weekend
+     */
+    [[nodiscard]] constexpr bool contains(const std::chrono::weekday wd) const noexcept {
+        return wd.ok() && ((bits_ >> wd.c_encoding()) & 1U) != 0;
+    }
+
+    /**
+     * @brief Get the raw mask (bit N set when the weekday with C encoding N is a weekend day)
+     */
+    [[nodiscard]] constexpr std::uint8_t bits() const noexcept { return bits_; }
+
+    [[nodiscard]] constexpr bool operator==(const WeekendMask& other) const noexcept = default;
+
+  private:
+    std::uint8_t bits_{0};
+};
+
 } // namespace datelib
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace datelib {
+
+/**
+ * @brief Reasons a non-throwing datelib function can fail
+ */
+enum class ErrorCode : std::uint8_t {
+    EmptyPeriod,                 ///< The period string is empty
+    MissingPeriodValue,          ///< The period string has no numeric value
+    InvalidPeriodFormat,         ///< The numeric value is not followed by a single unit character
+    InvalidPeriodValue,          ///< The numeric value does not fit in an int
+    InvalidPeriodUnit,           ///< The unit character is not D, W, M or Y
+    InvalidCompoundPeriod,       ///< A compound period is not years followed by months
+    InvalidDate,                 ///< An input date is not a valid calendar date
+    NextBusinessDayNotFound,     ///< No business day follows within a year
+    PreviousBusinessDayNotFound, ///< No business day precedes within a year
+    NearestBusinessDayNotFound,  ///< No business day lies within a year on either side
+    BusinessDaysNotReached,      ///< Over a year passes without a business day while counting
+    OccurrenceNotFound,          ///< The requested weekday occurrence does not exist in the month
+    UnhandledConvention          ///< The business day convention is not a known enumerator
+};
+
+/**
+ * @brief Error value returned by the try* functions
+ *
+ * An Error is a trivially copyable code: returning one never allocates. message() gives a static
+ * description, the same text the throwing functions put in their exceptions where that text does
+ * not depend on the input.
+ */
+class Error {
+  public:
+    constexpr explicit Error(const ErrorCode code) noexcept : code_(code) {}
+
+    /**
+     * @brief Get the error code
+     */
+    [[nodiscard]] constexpr ErrorCode code() const noexcept { return code_; }
+
+    /**
+     * @brief Get a static description of the error
+     */
+    [[nodiscard]] constexpr std::string_view message() const noexcept {
+        using enum ErrorCode;
+        switch (code_) {
+        case EmptyPeriod:
+            return "Period string cannot be empty";
+        case MissingPeriodValue:
+            return "Period string must contain a numeric value";
+        case InvalidPeriodFormat:
+            return "Period string must end with a single unit character (D/W/M/Y)";
+        case InvalidPeriodValue:
+            return "Invalid numeric value in period string";
+        case InvalidPeriodUnit:
+            return "Invalid period unit. Must be D, W, M, or Y";
+        case InvalidCompoundPeriod:
+            return "Compound period must be years followed by months";
+        case InvalidDate:
+            return "Invalid date";
+        case NextBusinessDayNotFound:
+            return "Unable to find next business day within reasonable range";
+        case PreviousBusinessDayNotFound:
+            return "Unable to find previous business day within reasonable range";
+        case NearestBusinessDayNotFound:
+            return "Unable to find nearest business day within reasonable range";
+        case BusinessDaysNotReached:
+            return "Unable to add business days within reasonable range";
+        case OccurrenceNotFound:
+            return "Requested occurrence does not exist in this month";
+        case UnhandledConvention:
+            return "Unhandled BusinessDayConvention in adjust()";
+        }
+        return "Unknown error";
+    }
+
+    [[nodiscard]] constexpr bool operator==(const Error& other) const noexcept = default;
+
+  private:
+    ErrorCode code_;
+};
+
+} // namespace datelib
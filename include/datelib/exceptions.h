@@ -36,6 +36,14 @@ class OccurrenceNotFoundException : public std::runtime_error {
     using std::runtime_error::runtime_error;
 };
 
+/**
+ * @brief Exception thrown when a date lies outside the year range covered by a compiled calendar
+ */
+class DateOutOfRangeException : public std::out_of_range {
+  public:
+    using std::out_of_range::out_of_range;
+};
+
 /**
  * @brief Exception thrown when an enum value is not handled in a switch statement
  */
@@ -1,7 +1,15 @@
 #pragma once
 
+#include "datelib/error.h"
+
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace datelib {
 
@@ -10,6 +18,23 @@ namespace datelib {
  *
  * A Period represents a duration specified in days (D), weeks (W), months (M), or years (Y).
  * It can be parsed from strings like "2W" (2 weeks), "6M" (6 months), or "10Y" (10 years).
+ *
+ * A Period holds a single unit. The only compound tenors accepted are years followed by months
+ * ("1Y6M"), stored as the equivalent number of months, which advances dates identically. Other
+ * combinations such as "1M2W" or "1W3D" mix calendar and business day units that do not fold
+ * into one, and are rejected with ErrorCode::InvalidCompoundPeriod.
+ *
+ * The money market tenors ON (overnight), TN (tom-next) and SN (spot-next) are offsets of their
+ * end date from the trade date, assuming a spot date two business days after the trade date
+ * (T+2): they are stored as 1D, 2D and 3D and cannot be told apart from those afterwards
+ * ("TN"_tenor == 2_D). For a market with another spot lag, advance to the spot date first and
+ * use day periods from there.
+ *
+ * Parsing is constexpr, and the literals in datelib::literals build periods at compile time:
+ * @code
+ *   using namespace datelib::literals;
+ *   static_assert("1Y6M"_tenor == 18_M);
+ * @endcode
  */
 class Period {
   public:
@@ -28,35 +53,233 @@ class Period {
      * @param value The number of units
      * @param unit The time unit
      */
-    Period(int value, Unit unit);
+    constexpr Period(const int value, const Unit unit) noexcept : value_(value), unit_(unit) {}
 
     /**
-     * @brief Parse a period from a string (e.g., "2W", "6M", "10Y")
+     * @brief Parse a period from a string (e.g., "2W", "6M", "10Y", "1Y6M", "ON")
      * @param period_str String representation of the period
      * @return Parsed Period object
      * @throws std::invalid_argument if the string is not a valid period
      *
-     * Valid formats:
+     * Valid formats (units are case-insensitive, and may be preceded by a '+' or '-' sign):
      * - "nD" or "nd" for n days
      * - "nW" or "nw" for n weeks
      * - "nM" or "nm" for n months
      * - "nY" or "ny" for n years
+     * - "nYmM" for n years and m months, parsed as 12n + m months; no other units combine
+     * - "ON", "TN" and "SN" for 1, 2 and 3 days, their end dates from the trade date at T+2
      */
     [[nodiscard]] static Period parse(std::string_view period_str);
 
+    /**
+     * @brief Parse a period from a string without throwing
+     * @param period_str String representation of the period, in the formats accepted by parse()
+     * @return The parsed Period, or the Error describing why the string is not a valid period
+     *
+     * Never allocates or throws, so rejecting malformed input costs no more than accepting it.
+     */
+    [[nodiscard]] static constexpr std::expected<Period, Error>
+    tryParse(std::string_view period_str) noexcept;
+
     /**
      * @brief Get the numeric value of the period
      */
-    [[nodiscard]] int value() const { return value_; }
+    [[nodiscard]] constexpr int value() const noexcept { return value_; }
 
     /**
      * @brief Get the unit of the period
      */
-    [[nodiscard]] Unit unit() const { return unit_; }
+    [[nodiscard]] constexpr Unit unit() const noexcept { return unit_; }
+
+    [[nodiscard]] constexpr bool operator==(const Period& other) const noexcept = default;
 
   private:
+    /**
+     * @brief Check for a decimal digit without consulting the locale
+     */
+    static constexpr bool isDigit(const char c) noexcept { return c >= '0' && c <= '9'; }
+
+    /**
+     * @brief Parse a unit character
+     */
+    static constexpr std::expected<Unit, Error> parseUnit(const char unit_char) noexcept {
+        using enum Unit;
+        switch (unit_char) {
+        case 'D':
+        case 'd':
+            return Days;
+        case 'W':
+        case 'w':
+            return Weeks;
+        case 'M':
+        case 'm':
+            return Months;
+        case 'Y':
+        case 'y':
+            return Years;
+        default:
+            return std::unexpected(Error{ErrorCode::InvalidPeriodUnit});
+        }
+    }
+
+    /**
+     * @brief Parse the money market tenors ON, TN and SN, in any case
+     * @return The business days from the trade date, or 0 if the string is not one of them
+     */
+    static constexpr int moneyMarketDays(const std::string_view period_str) noexcept {
+        if (period_str.size() != 2 || (period_str[1] != 'N' && period_str[1] != 'n')) {
+            return 0;
+        }
+        switch (period_str[0]) {
+        case 'O':
+        case 'o':
+            return 1;
+        case 'T':
+        case 't':
+            return 2;
+        case 'S':
+        case 's':
+            return 3;
+        default:
+            return 0;
+        }
+    }
+
     int value_;
     Unit unit_;
 };
 
+constexpr std::expected<Period, Error>
+Period::tryParse(const std::string_view period_str) noexcept {
+    if (period_str.empty()) {
+        return std::unexpected(Error{ErrorCode::EmptyPeriod});
+    }
+    if (const int days = moneyMarketDays(period_str); days != 0) {
+        return Period(days, Unit::Days);
+    }
+
+    // Optional sign at the beginning, applying to the whole period
+    const bool negative = period_str[0] == '-';
+    std::size_t position = (negative || period_str[0] == '+') ? 1 : 0;
+
+    // Magnitudes above this do not fit in an int once the sign is applied
+    constexpr std::int64_t MAX_INT_MAGNITUDE = std::numeric_limits<int>::max();
+    const std::int64_t max_magnitude = negative ? MAX_INT_MAGNITUDE + 1 : MAX_INT_MAGNITUDE;
+
+    std::int64_t total = 0;
+    Unit unit = Unit::Days;
+    bool first_component = true;
+    while (position < period_str.length()) {
+        // Numeric portion; the accumulation saturates so that long digit runs cannot overflow
+        const std::size_t digits_begin = position;
+        std::int64_t value = 0;
+        while (position < period_str.length() && isDigit(period_str[position])) {
+            if (value <= max_magnitude) {
+                value = value * 10 + (period_str[position] - '0');
+            }
+            position++;
+        }
+
+        // Every component needs at least one digit; only the first may lack it entirely
+        if (position == digits_begin) {
+            return std::unexpected(Error{first_component ? ErrorCode::MissingPeriodValue
+                                                         : ErrorCode::InvalidPeriodFormat});
+        }
+
+        // Followed by a unit character
+        if (position == period_str.length()) {
+            return std::unexpected(Error{ErrorCode::InvalidPeriodFormat});
+        }
+        const bool last_character = position + 1 == period_str.length();
+        const auto component_unit = parseUnit(period_str[position]);
+        if (!component_unit && !last_character) {
+            return std::unexpected(Error{ErrorCode::InvalidPeriodFormat});
+        }
+        if (value > max_magnitude) {
+            return std::unexpected(Error{ErrorCode::InvalidPeriodValue});
+        }
+        if (!component_unit) {
+            return std::unexpected(component_unit.error());
+        }
+        position++;
+
+        if (first_component) {
+            total = value;
+            unit = *component_unit;
+            first_component = false;
+        } else if (unit == Unit::Years && *component_unit == Unit::Months) {
+            total = total * 12 + value;
+            unit = Unit::Months;
+        } else {
+            return std::unexpected(Error{ErrorCode::InvalidCompoundPeriod});
+        }
+    }
+
+    if (first_component) {
+        // A sign alone
+        return std::unexpected(Error{ErrorCode::MissingPeriodValue});
+    }
+    if (total > max_magnitude) {
+        return std::unexpected(Error{ErrorCode::InvalidPeriodValue});
+    }
+    return Period(static_cast<int>(negative ? -total : total), unit);
+}
+
+inline namespace literals {
+
+/**
+ * @brief Literal for a period in days, e.g. 2_D
+ */
+consteval Period operator""_D(const unsigned long long value) {
+    if (value > static_cast<unsigned long long>(std::numeric_limits<int>::max())) {
+        throw std::invalid_argument("Period literal does not fit in an int");
+    }
+    return Period(static_cast<int>(value), Period::Unit::Days);
+}
+
+/**
+ * @brief Literal for a period in weeks, e.g. 1_W
+ */
+consteval Period operator""_W(const unsigned long long value) {
+    if (value > static_cast<unsigned long long>(std::numeric_limits<int>::max())) {
+        throw std::invalid_argument("Period literal does not fit in an int");
+    }
+    return Period(static_cast<int>(value), Period::Unit::Weeks);
+}
+
+/**
+ * @brief Literal for a period in months, e.g. 3_M
+ */
+consteval Period operator""_M(const unsigned long long value) {
+    if (value > static_cast<unsigned long long>(std::numeric_limits<int>::max())) {
+        throw std::invalid_argument("Period literal does not fit in an int");
+    }
+    return Period(static_cast<int>(value), Period::Unit::Months);
+}
+
+/**
+ * @brief Literal for a period in years, e.g. 10_Y
+ */
+consteval Period operator""_Y(const unsigned long long value) {
+    if (value > static_cast<unsigned long long>(std::numeric_limits<int>::max())) {
+        throw std::invalid_argument("Period literal does not fit in an int");
+    }
+    return Period(static_cast<int>(value), Period::Unit::Years);
+}
+
+/**
+ * @brief Literal for a period string parsed at compile time, e.g. "1Y6M"_tenor
+ *
+ * An invalid string does not compile.
+ */
+consteval Period operator""_tenor(const char* period_str, const std::size_t length) {
+    const auto period = Period::tryParse(std::string_view{period_str, length});
+    if (!period) {
+        throw std::invalid_argument("Invalid period literal");
+    }
+    return *period;
+}
+
+} // namespace literals
+
 } // namespace datelib
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace datelib::stats {
+
+/**
+ * @brief Whether this build of datelib counts anything
+ *
+ * Counting is compiled in only when datelib is built with DATELIB_ENABLE_STATS (the CMake option
+ * of the same name). Otherwise every counter stays at zero and the hot paths contain no
+ * counting code at all.
+ */
+#ifdef DATELIB_ENABLE_STATS
+inline constexpr bool ENABLED = true;
+#else
+inline constexpr bool ENABLED = false;
+#endif
+
+/**
+ * @brief Work counted on the calendar and business day search hot paths
+ */
+enum class Counter : std::uint8_t {
+    IsHolidayCalls,           ///< HolidayCalendar::isHoliday() calls
+    RuleEvaluations,          ///< Holiday rules evaluated, building years or naming holidays
+    YearCacheHits,            ///< Year lookups answered from an already built year
+    YearCacheMisses,          ///< Year lookups that had to build the year or wait for it
+    RuleExceptions,           ///< Exceptions thrown out of a rule's evaluation
+    NextBusinessDaySteps,     ///< Non-business days stepped over searching forward
+    PreviousBusinessDaySteps, ///< Non-business days stepped over searching backward
+    AddBusinessDaysSteps      ///< Calendar days walked while adding business days
+};
+
+inline constexpr std::size_t COUNTER_COUNT = 8;
+
+/**
+ * @brief Get the Prometheus metric name of a counter (e.g. "datelib_is_holiday_calls_total")
+ */
+[[nodiscard]] std::string_view metricName(Counter counter) noexcept;
+
+/**
+ * @brief Totals of every counter over all threads at one point in time
+ */
+class Snapshot {
+  public:
+    /**
+     * @brief Get the total of a counter
+     */
+    [[nodiscard]] std::uint64_t operator[](const Counter counter) const noexcept {
+        return values_[static_cast<std::size_t>(counter)];
+    }
+
+    /**
+     * @brief Format the snapshot in the Prometheus text exposition format
+     *
+     * Each counter is written with its HELP and TYPE lines, e.g.
+     * @code
+     *   # HELP datelib_is_holiday_calls_total HolidayCalendar::isHoliday() calls
+     *   # TYPE datelib_is_holiday_calls_total counter
+     *   datelib_is_holiday_calls_total 1024
+     * @endcode
+     */
+    [[nodiscard]] std::string toPrometheus() const;
+
+  private:
+    friend Snapshot snapshot();
+
+    std::array<std::uint64_t, COUNTER_COUNT> values_{};
+};
+
+/**
+ * @brief Add up the counters of every thread, including threads that have exited
+ *
+ * Each thread counts into its own cache line, so counting never contends between threads; the
+ * cost is paid here instead, under a lock held only while the threads' totals are read.
+ * @return The totals since the start of the program or the last reset()
+ */
+[[nodiscard]] Snapshot snapshot();
+
+/**
+ * @brief Start counting from zero again
+ *
+ * Threads keep counting while a reset happens: later snapshots report what was counted after it.
+ */
+void reset();
+
+} // namespace datelib::stats
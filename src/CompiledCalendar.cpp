@@ -0,0 +1,559 @@
+#include "datelib/CompiledCalendar.h"
+
+#include "datelib/exceptions.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdlib>
+#include <stdexcept>
+#include <string_view>
+
+#include "business_day_conventions.h"
+#include "date_arithmetic.h"
+#include "probes.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DATELIB_HAS_AVX2_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace datelib {
+
+using std::chrono::days;
+using std::chrono::sys_days;
+using std::chrono::year_month_day;
+
+namespace {
+// Number of bits in one bitmap word
+constexpr std::size_t BITS_PER_WORD = 64;
+
+// Number of bitmap words in one cache line
+constexpr std::size_t WORDS_PER_CACHE_LINE = 8;
+
+// Dates classified per step of the batch adjust
+constexpr std::size_t ADJUST_BLOCK_SIZE = 256;
+
+using DayRep = days::rep;
+static_assert(sizeof(sys_days) == sizeof(DayRep), "sys_days must be a plain day count");
+
+/**
+ * @brief Look up the business day bit of each date, one date at a time
+ * @return false if a date is outside [first_day, first_day + num_days)
+ */
+bool testBusinessDaysScalar(const std::uint64_t* plane, const sys_days first_day,
+                            const std::size_t num_days, const sys_days* dates, std::uint8_t* out,
+                            const std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        const DayRep index = (dates[i] - first_day).count();
+        if (index < 0 || static_cast<std::size_t>(index) >= num_days) {
+            return false;
+        }
+        const auto position = static_cast<std::size_t>(index);
+        out[i] = static_cast<std::uint8_t>((plane[position / BITS_PER_WORD] >>
+                                            (position % BITS_PER_WORD)) &
+                                           1U);
+    }
+    return true;
+}
+
+#ifdef DATELIB_HAS_AVX2_KERNELS
+/**
+ * @brief AVX2 lookup for 64-bit day counts: four dates per step, one 64-bit gather each
+ *
+ * Out-of-range lanes are masked out of the gather (so nothing outside the plane is read) and
+ * reported through the return value.
+ */
+[[maybe_unused]] __attribute__((target("avx2"))) bool
+testBusinessDaysAvx2(const std::uint64_t* plane, const std::int64_t first_day,
+                     const std::int64_t num_days, const sys_days* dates, std::uint8_t* out,
+                     const std::size_t count, std::size_t& processed) {
+    const __m256i first = _mm256_set1_epi64x(first_day);
+    const __m256i limit = _mm256_set1_epi64x(num_days);
+    const __m256i all_ones = _mm256_set1_epi64x(-1);
+    const __m256i bit_mask = _mm256_set1_epi64x(BITS_PER_WORD - 1);
+    const auto* base = reinterpret_cast<const long long*>(plane);
+    __m256i out_of_range = _mm256_setzero_si256();
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i index = _mm256_sub_epi64(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dates + i)), first);
+        // In range when -1 < index < num_days
+        const __m256i in_range = _mm256_and_si256(_mm256_cmpgt_epi64(index, all_ones),
+                                                  _mm256_cmpgt_epi64(limit, index));
+        out_of_range = _mm256_or_si256(out_of_range, _mm256_andnot_si256(in_range, all_ones));
+
+        const __m256i words = _mm256_mask_i64gather_epi64(
+            _mm256_setzero_si256(), base, _mm256_srli_epi64(index, 6), in_range, 8);
+        const __m256i bits = _mm256_srlv_epi64(words, _mm256_and_si256(index, bit_mask));
+        const auto lanes = static_cast<unsigned>(
+            _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_slli_epi64(bits, 63))));
+
+        for (unsigned lane = 0; lane < 4; ++lane) {
+            out[i + lane] = static_cast<std::uint8_t>((lanes >> lane) & 1U);
+        }
+    }
+
+    processed = i;
+    return _mm256_testz_si256(out_of_range, out_of_range) != 0;
+}
+
+/**
+ * @brief AVX2 lookup for 32-bit day counts: eight dates per step, one 32-bit gather each
+ *
+ * Used by standard libraries whose std::chrono::days is 32 bits wide.
+ */
+[[maybe_unused]] __attribute__((target("avx2"))) bool
+testBusinessDaysAvx2(const std::uint64_t* plane, const std::int32_t first_day,
+                     const std::int32_t num_days, const sys_days* dates, std::uint8_t* out,
+                     const std::size_t count, std::size_t& processed) {
+    const __m256i first = _mm256_set1_epi32(first_day);
+    const __m256i limit = _mm256_set1_epi32(num_days);
+    const __m256i all_ones = _mm256_set1_epi32(-1);
+    const __m256i bit_mask = _mm256_set1_epi32(31);
+    // Little-endian: bit n of the plane is bit n % 32 of 32-bit word n / 32
+    const auto* base = reinterpret_cast<const int*>(plane);
+    __m256i out_of_range = _mm256_setzero_si256();
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i index = _mm256_sub_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dates + i)), first);
+        const __m256i in_range = _mm256_and_si256(_mm256_cmpgt_epi32(index, all_ones),
+                                                  _mm256_cmpgt_epi32(limit, index));
+        out_of_range = _mm256_or_si256(out_of_range, _mm256_andnot_si256(in_range, all_ones));
+
+        const __m256i words = _mm256_mask_i32gather_epi32(
+            _mm256_setzero_si256(), base, _mm256_srli_epi32(index, 5), in_range, 4);
+        const __m256i bits = _mm256_srlv_epi32(words, _mm256_and_si256(index, bit_mask));
+        const auto lanes = static_cast<unsigned>(
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_slli_epi32(bits, 31))));
+
+        for (unsigned lane = 0; lane < 8; ++lane) {
+            out[i + lane] = static_cast<std::uint8_t>((lanes >> lane) & 1U);
+        }
+    }
+
+    processed = i;
+    return _mm256_testz_si256(out_of_range, out_of_range) != 0;
+}
+
+bool cpuHasAvx2() {
+    static const bool supported = __builtin_cpu_supports("avx2") != 0;
+    return supported;
+}
+#endif
+
+/**
+ * @brief Look up the business day bit of each date with the best kernel for this CPU
+ * @return false if a date is outside [first_day, first_day + num_days)
+ */
+bool testBusinessDays(const std::uint64_t* plane, const sys_days first_day,
+                      const std::size_t num_days, const sys_days* dates, std::uint8_t* out,
+                      const std::size_t count) {
+    std::size_t processed = 0;
+#ifdef DATELIB_HAS_AVX2_KERNELS
+    if (cpuHasAvx2()) {
+        if (!testBusinessDaysAvx2(plane, first_day.time_since_epoch().count(),
+                                  static_cast<DayRep>(num_days), dates, out, count, processed)) {
+            return false;
+        }
+    }
+#endif
+    // Remaining tail (or everything without AVX2)
+    return testBusinessDaysScalar(plane, first_day, num_days, dates + processed, out + processed,
+                                  count - processed);
+}
+
+/**
+ * @brief Message of the exception thrown when a search leaves the compiled range
+ */
+std::string_view rangeErrorMessage(const Error error) {
+    switch (error.code()) {
+    case ErrorCode::NextBusinessDayNotFound:
+        return "Unable to find next business day within the compiled range";
+    case ErrorCode::PreviousBusinessDayNotFound:
+        return "Unable to find previous business day within the compiled range";
+    case ErrorCode::NearestBusinessDayNotFound:
+        return "Unable to find nearest business day within the compiled range";
+    case ErrorCode::BusinessDaysNotReached:
+        return "Unable to add business days within the compiled range";
+    case ErrorCode::UnhandledConvention:
+        return "Unhandled BusinessDayConvention in CompiledCalendar::adjust()";
+    default:
+        return error.message();
+    }
+}
+} // namespace
+
+CompiledCalendar::CompiledCalendar(const int first_year, const int last_year)
+    : first_year_(first_year), last_year_(last_year),
+      first_day_(std::chrono::year{first_year} / std::chrono::January / 1) {
+    const sys_days end_day{std::chrono::year{last_year + 1} / std::chrono::January / 1};
+    num_days_ = static_cast<std::size_t>((end_day - first_day_).count());
+
+    const std::size_t words = (num_days_ + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    plane_words_ = (words + WORDS_PER_CACHE_LINE - 1) / WORDS_PER_CACHE_LINE * WORDS_PER_CACHE_LINE;
+
+    // No holidays yet and every day in range a business day
+    bits_.assign(2 * plane_words_, 0);
+    for (std::size_t index = 0; index < num_days_; ++index) {
+        bits_[plane_words_ + index / BITS_PER_WORD] |= std::uint64_t{1} << (index % BITS_PER_WORD);
+    }
+}
+
+void CompiledCalendar::markHoliday(const std::size_t index) noexcept {
+    bits_[index / BITS_PER_WORD] |= std::uint64_t{1} << (index % BITS_PER_WORD);
+    markNonBusinessDay(index);
+}
+
+void CompiledCalendar::markNonBusinessDay(const std::size_t index) noexcept {
+    bits_[plane_words_ + index / BITS_PER_WORD] &= ~(std::uint64_t{1} << (index % BITS_PER_WORD));
+}
+
+void CompiledCalendar::buildIndex() {
+    const std::uint64_t* plane = bits_.data() + plane_words_;
+
+    business_rank_.resize(plane_words_ + 1);
+    business_rank_[0] = 0;
+    for (std::size_t word_index = 0; word_index < plane_words_; ++word_index) {
+        const auto count = static_cast<std::uint32_t>(std::popcount(plane[word_index]));
+        business_rank_[word_index + 1] = business_rank_[word_index] + count;
+    }
+
+    // One pass in each direction, counting the days since the last business day seen
+    const auto step = [](const std::uint8_t distance) {
+        return distance >= FAR_DISTANCE - 1 ? FAR_DISTANCE
+                                            : static_cast<std::uint8_t>(distance + 1);
+    };
+    distances_.resize(num_days_);
+    std::uint8_t previous = FAR_DISTANCE;
+    for (std::size_t index = 0; index < num_days_; ++index) {
+        previous = businessBit(index) ? 0 : step(previous);
+        distances_[index].previous = previous;
+    }
+    std::uint8_t next = FAR_DISTANCE;
+    for (std::size_t index = num_days_; index-- > 0;) {
+        next = businessBit(index) ? 0 : step(next);
+        distances_[index].next = next;
+    }
+}
+
+bool CompiledCalendar::contains(const year_month_day& date) const noexcept {
+    if (!date.ok()) {
+        return false;
+    }
+    const auto year = static_cast<int>(date.year());
+    return year >= first_year_ && year <= last_year_;
+}
+
+std::size_t CompiledCalendar::indexOf(const year_month_day& date) const {
+    if (!contains(date)) {
+        throw DateOutOfRangeException("Date is outside the range of the compiled calendar");
+    }
+    return static_cast<std::size_t>(BusinessDate{date} - BusinessDate{first_day_});
+}
+
+std::size_t CompiledCalendar::indexOf(const BusinessDate date) const {
+    const auto offset = static_cast<std::size_t>(date - BusinessDate{first_day_});
+    // Dates before the range wrap around to large offsets
+    if (offset >= num_days_) {
+        throw DateOutOfRangeException("Date is outside the range of the compiled calendar");
+    }
+    return offset;
+}
+
+year_month_day CompiledCalendar::dateAt(const std::size_t index) const noexcept {
+    return businessDateAt(index).toYearMonthDay();
+}
+
+BusinessDate CompiledCalendar::businessDateAt(const std::size_t index) const noexcept {
+    return BusinessDate{first_day_} + static_cast<BusinessDate::rep>(index);
+}
+
+bool CompiledCalendar::holidayBit(const std::size_t index) const noexcept {
+    return ((bits_[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1U) != 0;
+}
+
+bool CompiledCalendar::businessBit(const std::size_t index) const noexcept {
+    return ((bits_[plane_words_ + index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1U) != 0;
+}
+
+std::size_t CompiledCalendar::nextBusinessDay(const std::size_t index) const noexcept {
+    if (index >= num_days_) {
+        return NPOS;
+    }
+
+    const std::uint64_t* plane = bits_.data() + plane_words_;
+    std::size_t word_index = index / BITS_PER_WORD;
+    // Ignore the days before index in the first word
+    std::uint64_t word = plane[word_index] & (~std::uint64_t{0} << (index % BITS_PER_WORD));
+
+    while (word == 0) {
+        if (++word_index == plane_words_) {
+            return NPOS;
+        }
+        word = plane[word_index];
+    }
+
+    return word_index * BITS_PER_WORD + static_cast<std::size_t>(std::countr_zero(word));
+}
+
+std::size_t CompiledCalendar::previousBusinessDay(const std::size_t index) const noexcept {
+    if (index >= num_days_) {
+        return NPOS;
+    }
+
+    const std::uint64_t* plane = bits_.data() + plane_words_;
+    std::size_t word_index = index / BITS_PER_WORD;
+    // Ignore the days after index in the first word
+    std::uint64_t word =
+        plane[word_index] & (~std::uint64_t{0} >> (BITS_PER_WORD - 1 - index % BITS_PER_WORD));
+
+    while (word == 0) {
+        if (word_index == 0) {
+            return NPOS;
+        }
+        word = plane[--word_index];
+    }
+
+    return word_index * BITS_PER_WORD + (BITS_PER_WORD - 1) -
+           static_cast<std::size_t>(std::countl_zero(word));
+}
+
+std::size_t CompiledCalendar::businessRank(const std::size_t index) const noexcept {
+    const std::size_t word_index = index / BITS_PER_WORD;
+    const std::size_t bit = index % BITS_PER_WORD;
+    std::size_t rank = business_rank_[word_index];
+    if (bit != 0) {
+        const std::uint64_t below =
+            bits_[plane_words_ + word_index] & ((std::uint64_t{1} << bit) - 1);
+        rank += static_cast<std::size_t>(std::popcount(below));
+    }
+    return rank;
+}
+
+std::size_t CompiledCalendar::selectBusinessDay(const std::size_t rank) const noexcept {
+    if (rank >= business_rank_.back()) {
+        return NPOS;
+    }
+
+    // Last word whose preceding count does not exceed rank; it holds the wanted day
+    const auto it = std::ranges::upper_bound(business_rank_, rank);
+    const auto word_index = static_cast<std::size_t>(it - business_rank_.begin()) - 1;
+
+    // Drop the lower business days of the word until the wanted one is the lowest set bit
+    std::uint64_t word = bits_[plane_words_ + word_index];
+    for (std::size_t skip = rank - business_rank_[word_index]; skip > 0; --skip) {
+        word &= word - 1;
+    }
+
+    return word_index * BITS_PER_WORD + static_cast<std::size_t>(std::countr_zero(word));
+}
+
+void CompiledCalendar::isBusinessDay(const std::span<const sys_days> dates,
+                                     const std::span<std::uint8_t> out) const {
+    if (out.size() != dates.size()) {
+        throw std::invalid_argument("Output span must have the same size as the input dates");
+    }
+    if (!testBusinessDays(bits_.data() + plane_words_, first_day_, num_days_, dates.data(),
+                          out.data(), dates.size())) {
+        throw DateOutOfRangeException("Date is outside the range of the compiled calendar");
+    }
+}
+
+void CompiledCalendar::adjust(const std::span<const sys_days> dates, const std::span<sys_days> out,
+                              const BusinessDayConvention convention) const {
+    if (out.size() != dates.size()) {
+        throw std::invalid_argument("Output span must have the same size as the input dates");
+    }
+    DATELIB_PROBE(adjust_batch_entry, dates.size(), static_cast<int>(convention));
+
+    std::array<std::uint8_t, ADJUST_BLOCK_SIZE> business{};
+    [[maybe_unused]] std::size_t moved = 0;
+    for (std::size_t start = 0; start < dates.size(); start += ADJUST_BLOCK_SIZE) {
+        const std::size_t count = std::min(ADJUST_BLOCK_SIZE, dates.size() - start);
+        if (!testBusinessDays(bits_.data() + plane_words_, first_day_, num_days_,
+                              dates.data() + start, business.data(), count)) {
+            throw DateOutOfRangeException("Date is outside the range of the compiled calendar");
+        }
+
+        // Business days stay as they are; only the others are searched for
+        for (std::size_t i = 0; i < count; ++i) {
+            const sys_days date = dates[start + i];
+            if (business[i] == 0) {
+                const auto index = static_cast<std::size_t>((date - first_day_).count());
+                out[start + i] =
+                    first_day_ + days{static_cast<DayRep>(adjustIndex(index, convention))};
+                moved += out[start + i] != date ? 1 : 0;
+            } else {
+                out[start + i] = date;
+            }
+        }
+    }
+    DATELIB_PROBE(adjust_batch_return, dates.size(), static_cast<int>(convention), moved);
+}
+
+int CompiledCalendar::businessDaysBetween(const year_month_day& from,
+                                          const year_month_day& to) const {
+    if (!from.ok() || !to.ok()) {
+        throw std::invalid_argument("Invalid date provided to businessDaysBetween");
+    }
+
+    // Business days in (from, to] are those ranked before to + 1 but not before from + 1
+    const auto from_rank = static_cast<long long>(businessRank(indexOf(from) + 1));
+    const auto to_rank = static_cast<long long>(businessRank(indexOf(to) + 1));
+    return static_cast<int>(to_rank - from_rank);
+}
+
+bool CompiledCalendar::isHoliday(const year_month_day& date) const {
+    if (!date.ok()) {
+        throw std::invalid_argument("Invalid date provided to isHoliday");
+    }
+    return holidayBit(indexOf(date));
+}
+
+bool CompiledCalendar::isBusinessDay(const year_month_day& date) const {
+    if (!date.ok()) {
+        throw std::invalid_argument("Invalid date provided to isBusinessDay");
+    }
+    return businessBit(indexOf(date));
+}
+
+bool CompiledCalendar::isHoliday(const BusinessDate date) const {
+    return holidayBit(indexOf(date));
+}
+
+bool CompiledCalendar::isBusinessDay(const BusinessDate date) const {
+    return businessBit(indexOf(date));
+}
+
+std::size_t CompiledCalendar::adjustIndex(const std::size_t index,
+                                          const BusinessDayConvention convention) const {
+    // One load tells whether the day is a business day and where the nearest ones are
+    const BusinessDayDistance distance = distances_[index];
+    if (distance.next == 0) {
+        return index;
+    }
+
+    // Only business days further than the table reaches need a scan
+    const BusinessDate date = businessDateAt(index);
+    const auto next = [&]() -> std::expected<BusinessDate, Error> {
+        const std::size_t found =
+            distance.next != FAR_DISTANCE ? index + distance.next : nextBusinessDay(index);
+        if (found == NPOS) {
+            return std::unexpected(Error{ErrorCode::NextBusinessDayNotFound});
+        }
+        return businessDateAt(found);
+    };
+    const auto previous = [&]() -> std::expected<BusinessDate, Error> {
+        const std::size_t found = distance.previous != FAR_DISTANCE ? index - distance.previous
+                                                                    : previousBusinessDay(index);
+        if (found == NPOS) {
+            return std::unexpected(Error{ErrorCode::PreviousBusinessDayNotFound});
+        }
+        return businessDateAt(found);
+    };
+
+    // The searches end at the ends of the range, beyond which Nearest cannot tell
+    const detail::SearchReach reach{static_cast<int>(num_days_ - 1 - index),
+                                    static_cast<int>(index)};
+    const auto adjusted = detail::applyConvention(date, convention, reach, next, previous);
+    if (!adjusted) {
+        detail::throwError(adjusted.error(), date, convention, rangeErrorMessage(adjusted.error()));
+    }
+    return static_cast<std::size_t>(static_cast<std::ptrdiff_t>(index) + (*adjusted - date));
+}
+
+year_month_day CompiledCalendar::adjust(const year_month_day& date,
+                                        const BusinessDayConvention convention) const {
+    if (!date.ok()) {
+        throw std::invalid_argument("Invalid date provided to adjust");
+    }
+    return adjust(BusinessDate{date}, convention).toYearMonthDay();
+}
+
+BusinessDate CompiledCalendar::adjust(const BusinessDate date,
+                                      const BusinessDayConvention convention) const {
+    DATELIB_PROBE(adjust_entry, date.serial(), static_cast<int>(convention));
+    const BusinessDate adjusted = businessDateAt(adjustIndex(indexOf(date), convention));
+    DATELIB_PROBE(adjust_return, date.serial(), static_cast<int>(convention), adjusted.serial(),
+                  std::abs(adjusted - date));
+    return adjusted;
+}
+
+std::size_t CompiledCalendar::addBusinessDaysIndex(const std::size_t index,
+                                                   const int business_days,
+                                                   const BusinessDayConvention convention) const {
+    if (business_days == 0) {
+        return index;
+    }
+
+    // The Nth business day after index has rank (business days up to and including index) + N - 1;
+    // the Nth business day before it has rank (business days before index) - N
+    const auto steps = static_cast<std::size_t>(std::abs(business_days));
+    std::size_t target = NPOS;
+    if (business_days > 0) {
+        target = selectBusinessDay(businessRank(index + 1) + steps - 1);
+    } else if (const std::size_t before = businessRank(index); before >= steps) {
+        target = selectBusinessDay(before - steps);
+    }
+
+    if (target == NPOS) {
+        const Error error{ErrorCode::BusinessDaysNotReached};
+        detail::throwError(error, businessDateAt(index), convention, rangeErrorMessage(error));
+    }
+    return target;
+}
+
+year_month_day CompiledCalendar::advance(const year_month_day& date, const Period& period,
+                                         const BusinessDayConvention convention) const {
+    if (!date.ok()) {
+        throw InvalidDateException("Invalid date provided to advance");
+    }
+
+    const BusinessDate start{date};
+    DATELIB_PROBE(advance_entry, start.serial(), period.value(), static_cast<int>(period.unit()),
+                  static_cast<int>(convention));
+    const std::size_t index =
+        period.unit() != Period::Unit::Days
+            ? adjustIndex(indexOf(detail::addCalendarPeriod(date, period)), convention)
+            : addBusinessDaysIndex(indexOf(date), period.value(), convention);
+    const BusinessDate advanced = businessDateAt(index);
+    DATELIB_PROBE(advance_return, start.serial(), static_cast<int>(convention), advanced.serial(),
+                  std::abs(advanced - start));
+    return advanced.toYearMonthDay();
+}
+
+void CompiledCalendar::advance(const year_month_day& anchor, const std::span<const Period> periods,
+                               const std::span<year_month_day> out,
+                               const BusinessDayConvention convention) const {
+    if (!anchor.ok()) {
+        throw InvalidDateException("Invalid date provided to advance");
+    }
+    if (out.size() != periods.size()) {
+        throw std::invalid_argument("Output span must have the same size as the periods");
+    }
+
+    // Decompose the anchor once; its position is only needed by business day periods
+    const detail::CalendarAnchor decomposed{anchor};
+    std::size_t anchor_index = NPOS;
+
+    for (std::size_t i = 0; i < periods.size(); ++i) {
+        const Period& period = periods[i];
+        if (period.unit() != Period::Unit::Days) {
+            const year_month_day shifted = detail::addCalendarPeriod(decomposed, period);
+            out[i] = dateAt(adjustIndex(indexOf(shifted), convention));
+            continue;
+        }
+
+        if (anchor_index == NPOS) {
+            anchor_index = indexOf(anchor);
+        }
+        out[i] = dateAt(addBusinessDaysIndex(anchor_index, period.value(), convention));
+    }
+}
+
+} // namespace datelib
@@ -1,78 +1,477 @@
 #include "datelib/HolidayCalendar.h"
 
 #include <algorithm>
-#include <ranges>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <typeinfo>
+
+#include "probes.h"
+#include "stats_counters.h"
 
 namespace datelib {
 
+using std::chrono::days;
+using std::chrono::sys_days;
 using std::chrono::year_month_day;
 
-HolidayCalendar::HolidayCalendar(const HolidayCalendar& other) {
-    // Deep copy the rules
-    rules_.reserve(other.rules_.size());
-    for (const auto& rule : other.rules_) {
-        rules_.push_back(rule->clone());
+namespace {
+// Number of bits in one bitmap word
+constexpr unsigned BITS_PER_WORD = 64;
+
+// Number of days in a week
+constexpr unsigned DAYS_PER_WEEK = 7;
+
+/**
+ * @brief Evaluate a built-in rule for a year
+ *
+ * The qualified calls bind to the concrete type at compile time, so no virtual dispatch happens.
+ */
+template <typename Rule>
+std::optional<year_month_day> dateInYear(const Rule& rule, const int year) {
+    return rule.Rule::tryDate(year);
+}
+
+std::optional<year_month_day> dateInYear(const detail::CustomRule& rule, const int year) {
+    return rule.get().tryDate(year);
+}
+
+/**
+ * @brief Evaluate a stored rule for a year
+ * @return The holiday date, or std::nullopt if the rule does not apply to that year
+ */
+std::optional<year_month_day> dateInYear(const detail::StoredRule& stored, const int year) {
+    const auto evaluate = [year](const auto& rule) { return dateInYear(rule, year); };
+    detail::countStat(stats::Counter::RuleEvaluations);
+#ifdef DATELIB_ENABLE_STATS
+    try {
+        return std::visit(evaluate, stored);
+    } catch (...) {
+        detail::countStat(stats::Counter::RuleExceptions);
+        throw;
     }
+#else
+    return std::visit(evaluate, stored);
+#endif
 }
 
+template <typename Rule>
+std::string nameOf(const Rule& rule) {
+    return rule.Rule::getName();
+}
+
+std::string nameOf(const detail::CustomRule& rule) {
+    return rule.get().getName();
+}
+
+std::string nameOf(const detail::StoredRule& stored) {
+    return std::visit([](const auto& rule) { return nameOf(rule); }, stored);
+}
+} // namespace
+
+// Built-in rules are copied by value and custom rules through clone(); the cache of the copy is
+// rebuilt on demand
+HolidayCalendar::HolidayCalendar(const HolidayCalendar& other)
+    : rules_(other.rules_), explicit_holidays_(other.explicit_holidays_) {}
+
 HolidayCalendar& HolidayCalendar::operator=(const HolidayCalendar& other) {
     if (this != &other) {
-        // Deep copy the rules
-        rules_.clear();
-        rules_.reserve(other.rules_.size());
-        for (const auto& rule : other.rules_) {
-            rules_.push_back(rule->clone());
-        }
+        rules_ = other.rules_;
+        explicit_holidays_ = other.explicit_holidays_;
+        invalidateCache();
+    }
+    return *this;
+}
+
+HolidayCalendar::HolidayCalendar(HolidayCalendar&& other) noexcept
+    : rules_(std::move(other.rules_)), explicit_holidays_(std::move(other.explicit_holidays_)) {
+    adoptCache(other);
+}
+
+HolidayCalendar& HolidayCalendar::operator=(HolidayCalendar&& other) noexcept {
+    if (this != &other) {
+        rules_ = std::move(other.rules_);
+        explicit_holidays_ = std::move(other.explicit_holidays_);
+        adoptCache(other);
     }
     return *this;
 }
 
 void HolidayCalendar::addHoliday(const std::string& name, const year_month_day& date) {
-    rules_.push_back(std::make_unique<ExplicitDateRule>(name, date));
+    if (!date.ok()) {
+        throw std::invalid_argument("Invalid date");
+    }
+
+    // Insert after any equal dates; appending in chronological order never moves elements
+    const sys_days day{date};
+    const auto position = std::ranges::upper_bound(explicit_holidays_, day, std::less{},
+                                                   &detail::ExplicitHoliday::date);
+    explicit_holidays_.insert(position, detail::ExplicitHoliday{day, name});
+    invalidateCache();
+}
+
+void HolidayCalendar::addHolidays(
+    const std::span<const std::pair<std::string, year_month_day>> holidays) {
+    // Validate everything first so that a bad date leaves the calendar unchanged
+    if (std::ranges::any_of(holidays, [](const auto& holiday) { return !holiday.second.ok(); })) {
+        throw std::invalid_argument("Invalid date");
+    }
+
+    const auto old_size = static_cast<std::ptrdiff_t>(explicit_holidays_.size());
+    explicit_holidays_.reserve(explicit_holidays_.size() + holidays.size());
+    for (const auto& [name, date] : holidays) {
+        explicit_holidays_.push_back(detail::ExplicitHoliday{sys_days{date}, name});
+    }
+
+    // Sort the new tail once, then merge it with the already sorted dates
+    const auto middle = explicit_holidays_.begin() + old_size;
+    std::ranges::stable_sort(middle, explicit_holidays_.end(), std::less{},
+                             &detail::ExplicitHoliday::date);
+    std::ranges::inplace_merge(explicit_holidays_, middle, std::less{},
+                               &detail::ExplicitHoliday::date);
+    invalidateCache();
 }
 
 void HolidayCalendar::addRule(std::unique_ptr<HolidayRule> rule) {
-    rules_.push_back(std::move(rule));
+    if (!rule) {
+        throw std::invalid_argument("Rule must not be null");
+    }
+
+    // Store built-in rules inline; an exact type match keeps subclasses from being sliced
+    const std::type_info& type = typeid(*rule);
+    if (type == typeid(ExplicitDateRule)) {
+        const auto& explicit_rule = static_cast<const ExplicitDateRule&>(*rule);
+        addHoliday(explicit_rule.getName(), explicit_rule.date());
+        return;
+    }
+
+    if (type == typeid(FixedDateRule)) {
+        rules_.emplace_back(std::move(static_cast<FixedDateRule&>(*rule)));
+    } else if (type == typeid(NthWeekdayRule)) {
+        rules_.emplace_back(std::move(static_cast<NthWeekdayRule&>(*rule)));
+    } else if (type == typeid(EasterRule)) {
+        rules_.emplace_back(std::move(static_cast<EasterRule&>(*rule)));
+    } else if (type == typeid(OffsetFromRule)) {
+        rules_.emplace_back(std::move(static_cast<OffsetFromRule&>(*rule)));
+    } else if (type == typeid(ObservedRule)) {
+        rules_.emplace_back(std::move(static_cast<ObservedRule&>(*rule)));
+    } else {
+        rules_.emplace_back(std::in_place_type<detail::CustomRule>, std::move(rule));
+    }
+    invalidateCache();
 }
 
 bool HolidayCalendar::isHoliday(const year_month_day& date) const {
-    auto year = static_cast<int>(date.year());
+    detail::countStat(stats::Counter::IsHolidayCalls);
+    // An invalid date never matches a rule
+    if (!date.ok()) {
+        return false;
+    }
 
-    return std::ranges::any_of(rules_, [&](const auto& rule) {
-        return rule->appliesTo(year) && rule->calculateDate(year) == date;
-    });
+    const BusinessDate serial{date};
+    DATELIB_PROBE(is_holiday_entry, serial.serial());
+    const int year = static_cast<int>(date.year());
+    const bool holiday = yearBitmap(year).test(
+        static_cast<unsigned>(serial.serial() - BusinessDate::serialOf(year, 1, 1)));
+    DATELIB_PROBE(is_holiday_return, serial.serial(), static_cast<int>(holiday));
+    return holiday;
+}
+
+bool HolidayCalendar::isHoliday(const BusinessDate date) const {
+    detail::countStat(stats::Counter::IsHolidayCalls);
+    DATELIB_PROBE(is_holiday_entry, date.serial());
+    const int year = date.year();
+    const bool holiday = yearBitmap(year).test(
+        static_cast<unsigned>(date.serial() - BusinessDate::serialOf(year, 1, 1)));
+    DATELIB_PROBE(is_holiday_return, date.serial(), static_cast<int>(holiday));
+    return holiday;
 }
 
 std::vector<year_month_day> HolidayCalendar::getHolidays(const int year) const {
-    std::vector<year_month_day> holidays;
-    holidays.reserve(rules_.size());
+    DATELIB_PROBE(get_holidays_entry, year);
+    const YearBitmap& bitmap = yearBitmap(year);
+    const sys_days first_of_year{std::chrono::year{year} / std::chrono::January / 1};
 
-    // Collect all holidays from rules that apply to this year
-    for (const auto& rule : rules_) {
-        if (rule->appliesTo(year)) {
-            holidays.push_back(rule->calculateDate(year));
+    std::vector<year_month_day> holidays;
+    for (std::size_t word_index = 0; word_index < YearBitmap::WORDS; ++word_index) {
+        // Walk the set bits of each word; the result is sorted and free of duplicates
+        for (std::uint64_t word = bitmap.words[word_index]; word != 0; word &= word - 1) {
+            const auto offset = word_index * BITS_PER_WORD +
+                                static_cast<std::size_t>(std::countr_zero(word));
+            holidays.emplace_back(first_of_year + days{static_cast<days::rep>(offset)});
         }
     }
 
-    // Sort and remove duplicates
-    std::ranges::sort(holidays);
-    auto [new_end, end] = std::ranges::unique(holidays);
-    holidays.erase(new_end, end);
-
+    DATELIB_PROBE(get_holidays_return, year, holidays.size());
     return holidays;
 } // LCOV_EXCL_LINE
 
 std::vector<std::string> HolidayCalendar::getHolidayNames(const year_month_day& date) const {
     std::vector<std::string> names;
-    const auto year = static_cast<int>(date.year());
 
-    for (const auto& rule : rules_) {
-        if (rule->appliesTo(year) && rule->calculateDate(year) == date) {
-            names.push_back(rule->getName());
-        }
+    // Most dates are not holidays; answer those from the cache without touching the rules
+    if (!isHoliday(date)) {
+        return names;
+    }
+
+    const sys_days day{date};
+    forEachRuleHoliday(static_cast<int>(date.year()),
+                       [&](const sys_days holiday, const detail::StoredRule& rule) {
+                           if (holiday == day) {
+                               names.push_back(nameOf(rule));
+                           }
+                       });
+
+    const auto [first, last] = std::ranges::equal_range(
+        explicit_holidays_, sys_days{date}, std::less{}, &detail::ExplicitHoliday::date);
+    for (const auto& holiday : std::ranges::subrange(first, last)) {
+        names.push_back(holiday.name);
     }
 
     return names;
 } // LCOV_EXCL_LINE
 
+CompiledCalendar HolidayCalendar::compile(
+    const int first_year, const int last_year,
+    const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) const {
+    return compile(first_year, last_year, WeekendMask{weekend_days});
+}
+
+CompiledCalendar HolidayCalendar::compile(const int first_year, const int last_year,
+                                          const WeekendMask weekend) const {
+    if (first_year > last_year) {
+        throw std::invalid_argument("First year must not be after last year");
+    }
+    // The day after the range must still be representable
+    if (first_year < static_cast<int>(std::chrono::year::min()) ||
+        last_year >= static_cast<int>(std::chrono::year::max())) {
+        throw std::invalid_argument("Year range is outside the supported range of years");
+    }
+
+    CompiledCalendar compiled(first_year, last_year);
+
+    // Weekend days repeat every week from the weekday of the first day in range
+    const unsigned first_weekday = std::chrono::weekday{compiled.first_day_}.c_encoding();
+    for (std::size_t index = 0; index < compiled.num_days_; ++index) {
+        const auto encoding = static_cast<unsigned>((first_weekday + index) % DAYS_PER_WEEK);
+        if (weekend.contains(std::chrono::weekday{encoding})) {
+            compiled.markNonBusinessDay(index);
+        }
+    }
+
+    // Copy each year's holidays to its offset in the flat range
+    for (int year = first_year; year <= last_year; ++year) {
+        const YearBitmap& bitmap = yearBitmap(year);
+        const sys_days first_of_year{std::chrono::year{year} / std::chrono::January / 1};
+        const auto year_offset =
+            static_cast<std::size_t>((first_of_year - compiled.first_day_).count());
+
+        for (std::size_t word_index = 0; word_index < YearBitmap::WORDS; ++word_index) {
+            for (std::uint64_t word = bitmap.words[word_index]; word != 0; word &= word - 1) {
+                compiled.markHoliday(year_offset + word_index * BITS_PER_WORD +
+                                     static_cast<std::size_t>(std::countr_zero(word)));
+            }
+        }
+    }
+
+    compiled.buildIndex();
+    return compiled;
+}
+
+const HolidayCalendar::YearBitmap& HolidayCalendar::yearBitmap(const int year) const {
+    // No valid date falls outside the years of std::chrono::year
+    if (year < FIRST_CACHED_YEAR || year > LAST_CACHED_YEAR) [[unlikely]] {
+        static const YearBitmap NO_HOLIDAYS;
+        return NO_HOLIDAYS;
+    }
+
+    // Fast path: the acquire loads pair with the release stores of materializeYear()
+    const auto offset = static_cast<std::size_t>(year - FIRST_CACHED_YEAR);
+    const YearChunk* const chunk =
+        year_chunks_[offset / YearChunk::YEARS].load(std::memory_order_acquire);
+    const std::size_t slot = offset % YearChunk::YEARS;
+    if (chunk != nullptr && chunk->ready[slot].load(std::memory_order_acquire)) [[likely]] {
+        detail::countStat(stats::Counter::YearCacheHits);
+        return chunk->bitmaps[slot];
+    }
+    detail::countStat(stats::Counter::YearCacheMisses);
+    return materializeYear(year);
+}
+
+const HolidayCalendar::YearBitmap& HolidayCalendar::materializeYear(const int year) const {
+    const std::scoped_lock lock(cache_mutex_);
+
+    const auto offset = static_cast<std::size_t>(year - FIRST_CACHED_YEAR);
+    std::atomic<YearChunk*>& published = year_chunks_[offset / YearChunk::YEARS];
+    // Writers are serialized by the mutex, so a relaxed load sees the latest chunk
+    YearChunk* chunk = published.load(std::memory_order_relaxed);
+    if (chunk == nullptr) {
+        chunk = chunk_storage_.emplace_back(std::make_unique<YearChunk>()).get();
+        published.store(chunk, std::memory_order_release);
+    }
+
+    // Another thread may have built the year while this one waited for the lock
+    const std::size_t slot = offset % YearChunk::YEARS;
+    if (!chunk->ready[slot].load(std::memory_order_relaxed)) {
+        chunk->bitmaps[slot] = buildYearBitmap(year);
+        chunk->ready[slot].store(true, std::memory_order_release);
+    }
+    return chunk->bitmaps[slot];
+}
+
+HolidayCalendar::YearBitmap HolidayCalendar::buildYearBitmap(const int year) const {
+    YearBitmap bitmap;
+
+    const sys_days first_of_year{std::chrono::year{year} / std::chrono::January / 1};
+    forEachRuleHoliday(year, [&](const sys_days date, const detail::StoredRule& /*rule*/) {
+        bitmap.set(static_cast<unsigned>((date - first_of_year).count()));
+    });
+
+    // One binary search finds the year's first explicit date; only that year's dates are visited
+    const sys_days last_of_year{std::chrono::year{year} / std::chrono::December / 31};
+    for (auto it = std::ranges::lower_bound(explicit_holidays_, first_of_year, std::less{},
+                                            &detail::ExplicitHoliday::date);
+         it != explicit_holidays_.end() && it->date <= last_of_year; ++it) {
+        bitmap.set(static_cast<unsigned>((it->date - first_of_year).count()));
+    }
+
+    return bitmap;
+}
+
+template <typename Visitor>
+void HolidayCalendar::forEachRuleHoliday(const int year, Visitor&& visit) const {
+    const auto is_observed = [](const detail::StoredRule& rule) {
+        return std::holds_alternative<ObservedRule>(rule);
+    };
+    if (std::ranges::none_of(rules_, is_observed)) {
+        for (const auto& rule : rules_) {
+            // Only dates inside the requested year can ever match a query for that year
+            if (const auto date = dateInYear(rule, year);
+                date && static_cast<int>(date->year()) == year) {
+                visit(sys_days{*date}, rule);
+            }
+        }
+        return;
+    }
+
+    // Observed dates can cross a year boundary and substitutes depend on every other holiday,
+    // so the year is resolved together with the years before and after it
+    const sys_days window_first{std::chrono::year{year - 1} / std::chrono::January / 1};
+    const sys_days window_last{std::chrono::year{year + 1} / std::chrono::December / 31};
+    std::vector<bool> occupied(static_cast<std::size_t>((window_last - window_first).count()) + 1);
+    const auto in_window = [&](const sys_days date) {
+        return date >= window_first && date <= window_last;
+    };
+    const auto is_occupied = [&](const sys_days date) {
+        return occupied[static_cast<std::size_t>((date - window_first).count())];
+    };
+    const auto place = [&](const sys_days date, const detail::StoredRule& rule) {
+        if (!in_window(date)) {
+            return;
+        }
+        occupied[static_cast<std::size_t>((date - window_first).count())] = true;
+        if (static_cast<int>(year_month_day{date}.year()) == year) {
+            visit(date, rule);
+        }
+    };
+
+    for (auto it = std::ranges::lower_bound(explicit_holidays_, window_first, std::less{},
+                                            &detail::ExplicitHoliday::date);
+         it != explicit_holidays_.end() && it->date <= window_last; ++it) {
+        occupied[static_cast<std::size_t>((it->date - window_first).count())] = true;
+    }
+
+    // Every date that is final on its own goes first: plain rules, the other observances, and
+    // substitute holidays that already fall on a weekday
+    for (int source_year = year - 1; source_year <= year + 1; ++source_year) {
+        for (const auto& rule : rules_) {
+            const auto* observed = std::get_if<ObservedRule>(&rule);
+            if (observed == nullptr || observed->observance() != Observance::Substitute) {
+                if (const auto date = dateInYear(rule, source_year)) {
+                    place(sys_days{*date}, rule);
+                }
+            } else if (const auto actual = observed->actualDate(source_year);
+                       actual && !observed->weekend().contains(std::chrono::weekday{*actual})) {
+                place(sys_days{*actual}, rule);
+            }
+        }
+    }
+
+    // Then substitutes for weekend dates, in chronological order and rules added earlier first
+    // on the same date, each taking the first weekday that is still free
+    struct WeekendSubstitute {
+        sys_days actual;
+        const detail::StoredRule* rule;
+        const ObservedRule* observed;
+    };
+    std::vector<WeekendSubstitute> substitutes;
+    for (int source_year = year - 1; source_year <= year + 1; ++source_year) {
+        for (const auto& rule : rules_) {
+            const auto* observed = std::get_if<ObservedRule>(&rule);
+            if (observed == nullptr || observed->observance() != Observance::Substitute) {
+                continue;
+            }
+            const auto actual = observed->actualDate(source_year);
+            if (actual && observed->weekend().contains(std::chrono::weekday{*actual})) {
+                substitutes.push_back({sys_days{*actual}, &rule, observed});
+            }
+        }
+    }
+    std::ranges::stable_sort(substitutes, std::less{}, &WeekendSubstitute::actual);
+
+    for (const auto& [actual, rule, observed] : substitutes) {
+        sys_days substitute = actual + days{1};
+        while (in_window(substitute) &&
+               (observed->weekend().contains(std::chrono::weekday{substitute}) ||
+                is_occupied(substitute))) {
+            substitute += days{1};
+        }
+        place(substitute, *rule);
+    }
+}
+
+std::shared_ptr<const CompiledCalendar>
+HolidayCalendar::compileShared(const int first_year, const int last_year,
+                               const WeekendMask weekend) const {
+    {
+        const std::scoped_lock lock(cache_mutex_);
+        if (shared_compiled_ && shared_weekend_ == weekend &&
+            shared_compiled_->firstYear() <= first_year &&
+            last_year <= shared_compiled_->lastYear()) {
+            return shared_compiled_;
+        }
+    }
+
+    // Compile without the lock, which materializing the years takes as well
+    auto compiled =
+        std::make_shared<const CompiledCalendar>(compile(first_year, last_year, weekend));
+    const std::scoped_lock lock(cache_mutex_);
+    shared_compiled_ = compiled;
+    shared_weekend_ = weekend;
+    return compiled;
+}
+
+void HolidayCalendar::invalidateCache() noexcept {
+    const std::scoped_lock lock(cache_mutex_);
+    for (auto& chunk : year_chunks_) {
+        chunk.store(nullptr, std::memory_order_relaxed);
+    }
+    chunk_storage_.clear();
+    shared_compiled_.reset();
+}
+
+void HolidayCalendar::adoptCache(HolidayCalendar& other) noexcept {
+    const std::scoped_lock lock(cache_mutex_, other.cache_mutex_);
+    chunk_storage_ = std::move(other.chunk_storage_);
+    other.chunk_storage_.clear();
+    shared_compiled_ = std::move(other.shared_compiled_);
+    shared_weekend_ = other.shared_weekend_;
+    for (std::size_t i = 0; i < YEAR_CHUNKS; ++i) {
+        year_chunks_[i].store(other.year_chunks_[i].exchange(nullptr, std::memory_order_relaxed),
+                              std::memory_order_relaxed);
+    }
+}
+
 } // namespace datelib
@@ -2,7 +2,10 @@
 
 #include "datelib/exceptions.h"
 
+#include <array>
+#include <cstdint>
 #include <stdexcept>
+#include <typeinfo>
 #include <utility>
 
 namespace datelib {
@@ -25,8 +28,70 @@ constexpr unsigned MIN_DAY = 1;
 constexpr unsigned MAX_DAY = 31;
 constexpr unsigned MAX_WEEKDAY = 6;
 constexpr unsigned DAYS_PER_WEEK = 7;
+
+/**
+ * @brief Days from March 22 to Easter Sunday (0 to 34), by the anonymous Gregorian algorithm
+ */
+constexpr std::uint8_t easterOffset(const int year) {
+    const int golden = year % 19;
+    const int century = year / 100;
+    const int year_of_century = year % 100;
+    const int epact = (19 * golden + century - century / 4 - (8 * century + 13) / 25 + 15) % 30;
+    const int weekday_correction =
+        (32 + 2 * (century % 4) + 2 * (year_of_century / 4) - epact - year_of_century % 4) % 7;
+    const int lunar_correction = (golden + 11 * epact + 22 * weekday_correction) / 451;
+    // Days after March 22; the full moon correction and weekday shift never go below zero
+    return static_cast<std::uint8_t>(epact + weekday_correction - 7 * lunar_correction);
+}
+
+// Easter Sunday of every supported year, as days from March 22, shared by all Easter rules
+constexpr auto EASTER_OFFSETS = [] {
+    std::array<std::uint8_t, EASTER_LAST_YEAR - EASTER_FIRST_YEAR + 1> offsets{};
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        offsets[i] = easterOffset(EASTER_FIRST_YEAR + static_cast<int>(i));
+    }
+    return offsets;
+}();
+
+/**
+ * @brief Move a date by a number of days, if the result stays in the given year
+ */
+std::optional<year_month_day> shiftWithinYear(const year_month_day& date, const int offset_days,
+                                              const int year) {
+    const year_month_day shifted{sys_days{date} + days{offset_days}};
+    if (static_cast<int>(shifted.year()) != year) {
+        return std::nullopt;
+    }
+    return shifted;
+}
+
+/**
+ * @brief Check whether a date falls on a weekend day
+ */
+bool isWeekend(const sys_days date, const WeekendMask weekend) {
+    return weekend.contains(weekday{date});
+}
+
+/**
+ * @brief Check that a rule is exactly a built-in type and not a subclass of it
+ *
+ * A subclass may override appliesTo() or calculateDate() without overriding tryDate(), so only
+ * the built-in type itself may skip them.
+ */
+template <typename Rule>
+bool isExactly(const Rule& rule) {
+    return typeid(rule) == typeid(Rule);
+}
 } // namespace
 
+// HolidayRule implementation
+std::optional<year_month_day> HolidayRule::tryDate(const int year) const {
+    if (!appliesTo(year)) {
+        return std::nullopt;
+    }
+    return calculateDate(year);
+}
+
 // ExplicitDateRule implementation
 ExplicitDateRule::ExplicitDateRule(std::string name, const year_month_day date)
     : name_(std::move(name)), date_(date) {
@@ -36,15 +101,30 @@ ExplicitDateRule::ExplicitDateRule(std::string name, const year_month_day date)
 }
 
 bool ExplicitDateRule::appliesTo(const int year) const {
-    return static_cast<int>(date_.year()) == year;
+    return dateIn(year).has_value();
 }
 
 year_month_day ExplicitDateRule::calculateDate(const int year) const {
+    const auto date = dateIn(year);
+    if (!date) {
+        throw DateNotInYearException("Explicit date does not exist in this year");
+    }
+    return *date;
+}
+
+std::optional<year_month_day> ExplicitDateRule::tryDate(const int year) const {
+    if (!isExactly(*this)) {
+        return HolidayRule::tryDate(year);
+    }
+    return dateIn(year);
+}
+
+std::optional<year_month_day> ExplicitDateRule::dateIn(const int year) const {
     // Only return the date if it matches the requested year
-    if (static_cast<int>(date_.year()) == year) {
-        return date_;
+    if (static_cast<int>(date_.year()) != year) {
+        return std::nullopt;
     }
-    throw DateNotInYearException("Explicit date does not exist in this year");
+    return date_;
 }
 
 std::unique_ptr<HolidayRule> ExplicitDateRule::clone() const {
@@ -63,14 +143,29 @@ FixedDateRule::FixedDateRule(std::string name, const unsigned month, const unsig
 }
 
 bool FixedDateRule::appliesTo(const int year) const {
-    const year_month_day ymd{std::chrono::year{year}, month_, day_};
-    return ymd.ok();
+    return dateIn(year).has_value();
 }
 
 year_month_day FixedDateRule::calculateDate(const int year) const {
+    const auto date = dateIn(year);
+    if (!date) {
+        throw InvalidDateException("Invalid date for this year");
+    }
+    return *date;
+}
+
+std::optional<year_month_day> FixedDateRule::tryDate(const int year) const {
+    if (!isExactly(*this)) {
+        return HolidayRule::tryDate(year);
+    }
+    return dateIn(year);
+}
+
+std::optional<year_month_day> FixedDateRule::dateIn(const int year) const {
+    // February 29 only exists in leap years
     const year_month_day ymd{std::chrono::year{year}, month_, day_};
     if (!ymd.ok()) {
-        throw InvalidDateException("Invalid date for this year");
+        return std::nullopt;
     }
     return ymd;
 }
@@ -97,31 +192,35 @@ NthWeekdayRule::NthWeekdayRule(std::string name, const unsigned month, const uns
 }
 
 bool NthWeekdayRule::appliesTo(const int year) const {
-    // For the Last occurrence, it always applies
-    const int occ_val = std::to_underlying(occurrence_);
-    if (occ_val < 0) {
-        return true;
-    }
+    // For the Last occurrence, it always applies; for the Nth, it must exist in the month
+    return tryCalculateDate(year).has_value();
+}
 
-    // For the Nth occurrence, check if it exists in the month
-    const year_month_day first_of_month{std::chrono::year{year}, month_, day{1}};
-    const sys_days first_sd{first_of_month};
-    const weekday first_weekday{first_sd};
+year_month_day NthWeekdayRule::calculateDate(const int year) const {
+    const auto date = tryCalculateDate(year);
+    if (!date) {
+        throw OccurrenceNotFoundException("Requested occurrence does not exist in this month");
+    }
+    return *date;
+}
 
-    const unsigned weekday_encoding = weekday_.c_encoding();
-    const unsigned first_weekday_encoding = first_weekday.c_encoding();
-    const unsigned days_until_target =
-        (weekday_encoding + DAYS_PER_WEEK - first_weekday_encoding) % DAYS_PER_WEEK;
-    const auto occ_val_u = static_cast<unsigned>(occ_val);
-    const auto offset_days =
-        static_cast<days::rep>(days_until_target + (occ_val_u - 1U) * DAYS_PER_WEEK);
-    const sys_days target_sd = first_sd + days{offset_days};
-    const year_month_day result{target_sd};
+std::optional<year_month_day> NthWeekdayRule::tryDate(const int year) const {
+    if (!isExactly(*this)) {
+        return HolidayRule::tryDate(year);
+    }
+    return dateIn(year);
+}
 
-    return result.month() == month_;
+std::optional<year_month_day> NthWeekdayRule::dateIn(const int year) const {
+    const auto date = tryCalculateDate(year);
+    if (!date) {
+        return std::nullopt;
+    }
+    return *date;
 }
 
-year_month_day NthWeekdayRule::calculateDate(const int year) const {
+std::expected<year_month_day, Error>
+NthWeekdayRule::tryCalculateDate(const int year) const noexcept {
     // Get the first day of the month
     const year_month_day first_of_month{std::chrono::year{year}, month_, day{1}};
 
@@ -146,7 +245,7 @@ year_month_day NthWeekdayRule::calculateDate(const int year) const {
 
         // Verify we're still in the same month
         if (result.month() != month_) {
-            throw OccurrenceNotFoundException("Requested occurrence does not exist in this month");
+            return std::unexpected(Error{ErrorCode::OccurrenceNotFound});
         }
 
         return result;
@@ -177,4 +276,177 @@ std::unique_ptr<HolidayRule> NthWeekdayRule::clone() const {
                                             weekday_.c_encoding(), occurrence_);
 }
 
+// EasterRule implementation
+EasterRule::EasterRule(std::string name, const int offset_days)
+    : name_(std::move(name)), offset_days_(offset_days) {}
+
+year_month_day EasterRule::easterSunday(const int year) {
+    if (year < EASTER_FIRST_YEAR || year > EASTER_LAST_YEAR) {
+        throw DateNotInYearException("Easter date is not available for this year");
+    }
+    const sys_days march_22{std::chrono::year{year} / std::chrono::March / 22};
+    return year_month_day{march_22 +
+                          days{EASTER_OFFSETS[static_cast<std::size_t>(year - EASTER_FIRST_YEAR)]}};
+}
+
+bool EasterRule::appliesTo(const int year) const {
+    return dateIn(year).has_value();
+}
+
+year_month_day EasterRule::calculateDate(const int year) const {
+    const auto date = dateIn(year);
+    if (!date) {
+        throw DateNotInYearException("Easter-based date does not fall in this year");
+    }
+    return *date;
+}
+
+std::optional<year_month_day> EasterRule::tryDate(const int year) const {
+    if (!isExactly(*this)) {
+        return HolidayRule::tryDate(year);
+    }
+    return dateIn(year);
+}
+
+std::optional<year_month_day> EasterRule::dateIn(const int year) const {
+    if (year < EASTER_FIRST_YEAR || year > EASTER_LAST_YEAR) {
+        return std::nullopt;
+    }
+    return shiftWithinYear(easterSunday(year), offset_days_, year);
+}
+
+std::unique_ptr<HolidayRule> EasterRule::clone() const {
+    return std::make_unique<EasterRule>(name_, offset_days_);
+}
+
+// OffsetFromRule implementation
+OffsetFromRule::OffsetFromRule(std::string name, std::unique_ptr<HolidayRule> base,
+                               const int offset_days)
+    : name_(std::move(name)), base_(std::move(base)), offset_days_(offset_days) {
+    if (!base_) {
+        throw std::invalid_argument("Base rule must not be null");
+    }
+}
+
+OffsetFromRule::OffsetFromRule(const OffsetFromRule& other)
+    : HolidayRule(other), name_(other.name_), base_(other.base_->clone()),
+      offset_days_(other.offset_days_) {}
+
+OffsetFromRule& OffsetFromRule::operator=(const OffsetFromRule& other) {
+    if (this != &other) {
+        name_ = other.name_;
+        base_ = other.base_->clone();
+        offset_days_ = other.offset_days_;
+    }
+    return *this;
+}
+
+bool OffsetFromRule::appliesTo(const int year) const {
+    return dateIn(year).has_value();
+}
+
+year_month_day OffsetFromRule::calculateDate(const int year) const {
+    const auto date = dateIn(year);
+    if (!date) {
+        throw DateNotInYearException("Offset date does not fall in this year");
+    }
+    return *date;
+}
+
+std::optional<year_month_day> OffsetFromRule::tryDate(const int year) const {
+    if (!isExactly(*this)) {
+        return HolidayRule::tryDate(year);
+    }
+    return dateIn(year);
+}
+
+std::optional<year_month_day> OffsetFromRule::dateIn(const int year) const {
+    const auto base_date = base_->tryDate(year);
+    if (!base_date) {
+        return std::nullopt;
+    }
+    return shiftWithinYear(*base_date, offset_days_, year);
+}
+
+std::unique_ptr<HolidayRule> OffsetFromRule::clone() const {
+    return std::make_unique<OffsetFromRule>(*this);
+}
+
+// ObservedRule implementation
+ObservedRule::ObservedRule(std::string name, std::unique_ptr<HolidayRule> rule,
+                           const Observance observance, const WeekendMask weekend)
+    : name_(std::move(name)), rule_(std::move(rule)), observance_(observance), weekend_(weekend) {
+    if (!rule_) {
+        throw std::invalid_argument("Observed rule must not be null");
+    }
+}
+
+ObservedRule::ObservedRule(const ObservedRule& other)
+    : HolidayRule(other), name_(other.name_), rule_(other.rule_->clone()),
+      observance_(other.observance_), weekend_(other.weekend_) {}
+
+ObservedRule& ObservedRule::operator=(const ObservedRule& other) {
+    if (this != &other) {
+        name_ = other.name_;
+        rule_ = other.rule_->clone();
+        observance_ = other.observance_;
+        weekend_ = other.weekend_;
+    }
+    return *this;
+}
+
+std::optional<year_month_day> ObservedRule::actualDate(const int year) const {
+    return rule_->tryDate(year);
+}
+
+bool ObservedRule::appliesTo(const int year) const {
+    return rule_->appliesTo(year);
+}
+
+year_month_day ObservedRule::calculateDate(const int year) const {
+    return observe(rule_->calculateDate(year));
+}
+
+std::optional<year_month_day> ObservedRule::tryDate(const int year) const {
+    if (!isExactly(*this)) {
+        return HolidayRule::tryDate(year);
+    }
+    return dateIn(year);
+}
+
+std::optional<year_month_day> ObservedRule::dateIn(const int year) const {
+    const auto actual_date = rule_->tryDate(year);
+    if (!actual_date) {
+        return std::nullopt;
+    }
+    return observe(*actual_date);
+}
+
+year_month_day ObservedRule::observe(const year_month_day& date) const {
+    const sys_days actual{date};
+    if (!isWeekend(actual, weekend_)) {
+        return year_month_day{actual};
+    }
+
+    // A week always contains a weekday unless every day is weekend, in which case nothing moves
+    for (int distance = 1; distance < static_cast<int>(DAYS_PER_WEEK); ++distance) {
+        const sys_days following = actual + days{distance};
+        if (!isWeekend(following, weekend_)) {
+            // The nearest weekday before wins only when it is strictly closer
+            for (int before = 1; observance_ == Observance::NearestWeekday && before < distance;
+                 ++before) {
+                if (!isWeekend(actual - days{before}, weekend_)) {
+                    return year_month_day{actual - days{before}};
+                }
+            }
+            return year_month_day{following};
+        }
+    }
+    return year_month_day{actual};
+}
+
+std::unique_ptr<HolidayRule> ObservedRule::clone() const {
+    return std::make_unique<ObservedRule>(*this);
+}
+
 } // namespace datelib
@@ -0,0 +1,269 @@
+#include "datelib/JointCalendar.h"
+
+#include "datelib/exceptions.h"
+
+#include <bit>
+#include <limits>
+#include <stdexcept>
+
+#include "business_day_conventions.h"
+#include "business_day_words.h"
+#include "date_arithmetic.h"
+
+namespace datelib {
+
+namespace {
+// Number of bits in one bitmap word
+constexpr unsigned BITS_PER_WORD = 64;
+
+using detail::DAYS_PER_WEEK;
+using detail::MAX_DAYS_TO_SEARCH;
+using detail::weekendWord;
+} // namespace
+
+JointCalendar::JointCalendar(
+    const std::vector<std::reference_wrapper<const HolidayCalendar>> calendars,
+    const JoinRule rule)
+    : rule_(rule) {
+    if (calendars.empty()) {
+        throw std::invalid_argument("JointCalendar needs at least one calendar");
+    }
+    calendars_.reserve(calendars.size());
+    for (const HolidayCalendar& calendar : calendars) {
+        calendars_.push_back(&calendar);
+    }
+}
+
+std::uint64_t JointCalendar::holidayWord(const int year, const std::size_t word_index) const {
+    std::uint64_t word = calendars_.front()->yearBitmap(year).words[word_index];
+    for (std::size_t i = 1; i < calendars_.size(); ++i) {
+        const std::uint64_t other = calendars_[i]->yearBitmap(year).words[word_index];
+        word = rule_ == JoinRule::JoinHolidays ? word | other : word & other;
+    }
+    return word;
+}
+
+HolidayCalendar::YearBitmap JointCalendar::holidays(const int year) const {
+    HolidayCalendar::YearBitmap joined = calendars_.front()->yearBitmap(year);
+    for (std::size_t i = 1; i < calendars_.size(); ++i) {
+        const HolidayCalendar::YearBitmap& other = calendars_[i]->yearBitmap(year);
+        for (std::size_t w = 0; w < HolidayCalendar::YearBitmap::WORDS; ++w) {
+            joined.words[w] = rule_ == JoinRule::JoinHolidays ? joined.words[w] | other.words[w]
+                                                              : joined.words[w] & other.words[w];
+        }
+    }
+    return joined;
+}
+
+bool JointCalendar::isHoliday(const std::chrono::year_month_day& date) const {
+    // An invalid date is never a holiday
+    if (!date.ok()) {
+        return false;
+    }
+    return isHoliday(BusinessDate{date});
+}
+
+bool JointCalendar::isHoliday(const BusinessDate date) const {
+    const int year = date.year();
+    const auto day_of_year =
+        static_cast<unsigned>(date.serial() - BusinessDate::serialOf(year, 1, 1));
+    return ((holidayWord(year, day_of_year / BITS_PER_WORD) >> (day_of_year % BITS_PER_WORD)) &
+            1U) != 0;
+}
+
+std::vector<std::chrono::year_month_day> JointCalendar::getHolidays(const int year) const {
+    const HolidayCalendar::YearBitmap joined = holidays(year);
+    const BusinessDate first_of_year = BusinessDate::fromSerial(BusinessDate::serialOf(year, 1, 1));
+
+    std::vector<std::chrono::year_month_day> result;
+    for (std::size_t word_index = 0; word_index < HolidayCalendar::YearBitmap::WORDS;
+         ++word_index) {
+        for (std::uint64_t word = joined.words[word_index]; word != 0; word &= word - 1) {
+            const auto offset = static_cast<BusinessDate::rep>(word_index * BITS_PER_WORD) +
+                                std::countr_zero(word);
+            result.push_back((first_of_year + offset).toYearMonthDay());
+        }
+    }
+    return result;
+}
+
+bool JointCalendar::isBusinessDay(const std::chrono::year_month_day& date,
+                                  const WeekendMask weekend) const {
+    if (!date.ok()) {
+        throw std::invalid_argument("Invalid date provided to isBusinessDay");
+    }
+    return isBusinessDay(BusinessDate{date}, weekend);
+}
+
+bool JointCalendar::isBusinessDay(const BusinessDate date, const WeekendMask weekend) const {
+    return !weekend.contains(date.weekday()) && !isHoliday(date);
+}
+
+void JointCalendar::loadYear(ClosedDays& closed, const BusinessDate date,
+                             const WeekendMask weekend) const {
+    const int year = date.year();
+    if (closed.year == year) {
+        return;
+    }
+
+    closed.year = year;
+    closed.first_day = BusinessDate::fromSerial(BusinessDate::serialOf(year, 1, 1));
+    closed.bits = holidays(year);
+
+    // Add the weekend; 64 days are 9 weeks and a day, so each word starts one weekday later
+    const unsigned first_weekday = closed.first_day.weekday().c_encoding();
+    for (std::size_t w = 0; w < HolidayCalendar::YearBitmap::WORDS; ++w) {
+        closed.bits.words[w] |=
+            weekendWord(weekend, static_cast<unsigned>((first_weekday + w) % DAYS_PER_WEEK));
+    }
+
+    // Close the days past the end of the year
+    const auto days_in_year = static_cast<unsigned>(
+        BusinessDate::serialOf(year + 1, 1, 1) - closed.first_day.serial());
+    const unsigned last_word = (days_in_year - 1) / BITS_PER_WORD;
+    closed.bits.words[last_word] |= ~std::uint64_t{0} << (days_in_year % BITS_PER_WORD);
+    for (std::size_t w = last_word + 1; w < HolidayCalendar::YearBitmap::WORDS; ++w) {
+        closed.bits.words[w] = ~std::uint64_t{0};
+    }
+}
+
+std::expected<BusinessDate, Error>
+JointCalendar::nextBusinessDay(const BusinessDate from, const int max_days, ClosedDays& closed,
+                               const WeekendMask weekend, const ErrorCode not_found) const {
+    const BusinessDate last = from + max_days;
+    BusinessDate current = from;
+    while (current <= last) {
+        loadYear(closed, current, weekend);
+        const auto day_of_year = static_cast<unsigned>(current - closed.first_day);
+        const unsigned word_index = day_of_year / BITS_PER_WORD;
+
+        // Open days of the word from the current day on
+        const std::uint64_t open =
+            ~closed.bits.words[word_index] & (~std::uint64_t{0} << (day_of_year % BITS_PER_WORD));
+        if (open != 0) {
+            const BusinessDate found =
+                closed.first_day +
+                static_cast<BusinessDate::rep>(word_index * BITS_PER_WORD) + std::countr_zero(open);
+            if (found > last) {
+                break;
+            }
+            return found;
+        }
+
+        // On to the next word; the closed bits past the year end make the last word of a year
+        // lead to January 1 of the next one
+        const BusinessDate next_word =
+            closed.first_day + static_cast<BusinessDate::rep>((word_index + 1) * BITS_PER_WORD);
+        const BusinessDate next_year =
+            BusinessDate::fromSerial(BusinessDate::serialOf(closed.year + 1, 1, 1));
+        current = next_word < next_year ? next_word : next_year;
+    }
+    return std::unexpected(Error{not_found});
+}
+
+std::expected<BusinessDate, Error>
+JointCalendar::previousBusinessDay(const BusinessDate from, const int max_days,
+                                   ClosedDays& closed, const WeekendMask weekend,
+                                   const ErrorCode not_found) const {
+    const BusinessDate first = from - max_days;
+    BusinessDate current = from;
+    while (current >= first) {
+        loadYear(closed, current, weekend);
+        const auto day_of_year = static_cast<unsigned>(current - closed.first_day);
+        const unsigned word_index = day_of_year / BITS_PER_WORD;
+
+        // Open days of the word up to the current day
+        const unsigned bit = day_of_year % BITS_PER_WORD;
+        const std::uint64_t up_to_current =
+            bit == BITS_PER_WORD - 1 ? ~std::uint64_t{0} : (std::uint64_t{2} << bit) - 1;
+        const std::uint64_t open = ~closed.bits.words[word_index] & up_to_current;
+        if (open != 0) {
+            const BusinessDate found =
+                closed.first_day + static_cast<BusinessDate::rep>(word_index * BITS_PER_WORD) +
+                static_cast<BusinessDate::rep>(BITS_PER_WORD - 1) - std::countl_zero(open);
+            if (found < first) {
+                break;
+            }
+            return found;
+        }
+
+        // Back to the last day of the previous word, or of the previous year
+        current = closed.first_day + static_cast<BusinessDate::rep>(word_index * BITS_PER_WORD) - 1;
+    }
+    return std::unexpected(Error{not_found});
+}
+
+std::expected<BusinessDate, Error>
+JointCalendar::tryAdjustSerial(const BusinessDate date, const BusinessDayConvention convention,
+                               const WeekendMask weekend) const {
+    // Most dates need no adjustment; answer those from a single word of each calendar
+    if (isBusinessDay(date, weekend)) {
+        return date;
+    }
+
+    ClosedDays closed{std::numeric_limits<int>::min(), {}, {}};
+    const auto next = [&] {
+        return nextBusinessDay(date, MAX_DAYS_TO_SEARCH, closed, weekend,
+                               ErrorCode::NextBusinessDayNotFound);
+    };
+    const auto previous = [&] {
+        return previousBusinessDay(date, MAX_DAYS_TO_SEARCH, closed, weekend,
+                                   ErrorCode::PreviousBusinessDayNotFound);
+    };
+
+    return detail::applyConvention(date, convention, detail::SearchReach{}, next, previous);
+}
+
+std::expected<BusinessDate, Error>
+JointCalendar::tryAdvanceSerial(const BusinessDate date, const Period& period,
+                                const BusinessDayConvention convention,
+                                const WeekendMask weekend) const {
+    if (period.unit() != Period::Unit::Days) {
+        const std::chrono::year_month_day shifted =
+            detail::addCalendarPeriod(date.toYearMonthDay(), period);
+        return tryAdjustSerial(BusinessDate{shifted}, convention, weekend);
+    }
+
+    // Business days: walk the combined bitmaps a word at a time
+    const auto holiday_word = [this](const int year, const std::size_t word_index) {
+        return holidayWord(year, word_index);
+    };
+    const auto walk = detail::addBusinessDays(date, period.value(), weekend, holiday_word);
+    if (!walk.found) {
+        return std::unexpected(Error{ErrorCode::BusinessDaysNotReached});
+    }
+    return walk.reached;
+}
+
+std::chrono::year_month_day JointCalendar::adjust(const std::chrono::year_month_day& date,
+                                                  const BusinessDayConvention convention,
+                                                  const WeekendMask weekend) const {
+    if (!date.ok()) {
+        throw std::invalid_argument("Invalid date provided to adjust");
+    }
+    return adjust(BusinessDate{date}, convention, weekend).toYearMonthDay();
+}
+
+BusinessDate JointCalendar::adjust(const BusinessDate date, const BusinessDayConvention convention,
+                                   const WeekendMask weekend) const {
+    return detail::valueOrThrow(tryAdjustSerial(date, convention, weekend), date, convention);
+}
+
+std::chrono::year_month_day JointCalendar::advance(const std::chrono::year_month_day& date,
+                                                   const Period& period,
+                                                   const BusinessDayConvention convention,
+                                                   const WeekendMask weekend) const {
+    if (!date.ok()) {
+        throw InvalidDateException("Invalid date provided to advance");
+    }
+    return advance(BusinessDate{date}, period, convention, weekend).toYearMonthDay();
+}
+
+BusinessDate JointCalendar::advance(const BusinessDate date, const Period& period,
+                                    const BusinessDayConvention convention,
+                                    const WeekendMask weekend) const {
+    return detail::valueOrThrow(tryAdvanceSerial(date, period, convention, weekend), date,
+                                convention);
+}
+
+} // namespace datelib
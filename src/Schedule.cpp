@@ -0,0 +1,164 @@
+#include "datelib/Schedule.h"
+
+#include "datelib/HolidayCalendar.h"
+#include "datelib/exceptions.h"
+
+#include <stdexcept>
+
+#include "date_arithmetic.h"
+
+namespace datelib {
+
+using std::chrono::year_month_day;
+
+namespace {
+// Number of days in a week
+constexpr std::int64_t DAYS_PER_WEEK = 7;
+
+// Number of months in a year
+constexpr std::int64_t MONTHS_PER_YEAR = 12;
+
+/**
+ * @brief Number of months in a month or year tenor
+ */
+std::int64_t monthsPerTenor(const Period& tenor) {
+    return tenor.unit() == Period::Unit::Years ? tenor.value() * MONTHS_PER_YEAR : tenor.value();
+}
+
+/**
+ * @brief Check that an output span can hold a schedule
+ */
+void requireCapacity(const std::span<year_month_day> out, const std::size_t size) {
+    if (out.size() < size) {
+        throw std::invalid_argument("Output span is too small for the schedule");
+    }
+}
+} // namespace
+
+Schedule::Schedule(const year_month_day& effective, const year_month_day& termination,
+                   const Period& tenor, const BusinessDayConvention convention,
+                   const DateGeneration generation, const StubType stub, const bool end_of_month)
+    : effective_(effective), termination_(termination), tenor_(tenor), convention_(convention),
+      generation_(generation), end_of_month_roll_(false), rolls_(0), size_(0), has_stub_(false) {
+    if (!effective.ok() || !termination.ok()) {
+        throw InvalidDateException("Invalid date provided to Schedule");
+    }
+    if (termination <= effective) {
+        throw std::invalid_argument("Termination date must be after the effective date");
+    }
+    if (tenor.unit() == Period::Unit::Days || tenor.value() <= 0) {
+        throw std::invalid_argument("Schedule tenor must be a positive number of weeks, months or "
+                                    "years");
+    }
+
+    const bool forward = generation == DateGeneration::Forward;
+    const year_month_day& anchor_date = forward ? effective : termination;
+    const year_month_day& far_end = forward ? termination : effective;
+    const detail::CalendarAnchor anchor{anchor_date};
+
+    // Month ends only roll to month ends for month-based tenors
+    const auto month_end = anchor_date.year() / anchor_date.month() / std::chrono::last;
+    end_of_month_roll_ = end_of_month && tenor.unit() != Period::Unit::Weeks &&
+                         anchor_date.day() == month_end.day();
+
+    const std::int64_t steps = countRegularSteps(anchor);
+    has_stub_ = rollDate(anchor, steps + 1) != far_end;
+
+    // A long stub absorbs the last roll date before the opposite end, if there is one to absorb
+    const bool merge_stub = has_stub_ && stub == StubType::Long && steps > 0;
+    rolls_ = static_cast<std::size_t>(merge_stub ? steps : steps + 1);
+    size_ = rolls_ + 1;
+}
+
+year_month_day Schedule::rollDate(const detail::CalendarAnchor& anchor,
+                                  const std::int64_t k) const {
+    const std::int64_t steps = generation_ == DateGeneration::Forward ? k : -k;
+
+    using enum Period::Unit;
+    switch (tenor_.unit()) {
+    case Days:
+        // Rejected by the constructor
+        break;
+
+    case Weeks:
+        return year_month_day{anchor.serial +
+                              std::chrono::days{steps * tenor_.value() * DAYS_PER_WEEK}};
+
+    case Months:
+    case Years: {
+        const year_month_day date = detail::addMonths(anchor, steps * monthsPerTenor(tenor_));
+        if (end_of_month_roll_) {
+            return year_month_day{date.year() / date.month() / std::chrono::last};
+        }
+        return date;
+    }
+    }
+
+    throw UnhandledEnumException("Unhandled Period::Unit in Schedule");
+}
+
+bool Schedule::beforeFarEnd(const year_month_day& date) const {
+    return generation_ == DateGeneration::Forward ? date < termination_ : date > effective_;
+}
+
+std::int64_t Schedule::countRegularSteps(const detail::CalendarAnchor& anchor) const {
+    // Estimate from the distance in whole tenors, then correct for day-of-month effects
+    std::int64_t steps = 0;
+    if (tenor_.unit() == Period::Unit::Weeks) {
+        const auto days = std::chrono::sys_days{termination_} - std::chrono::sys_days{effective_};
+        steps = days.count() / (tenor_.value() * DAYS_PER_WEEK);
+    } else {
+        const detail::CalendarAnchor start{effective_};
+        const detail::CalendarAnchor end{termination_};
+        steps = (end.month_index - start.month_index) / monthsPerTenor(tenor_);
+    }
+
+    while (beforeFarEnd(rollDate(anchor, steps + 1))) {
+        ++steps;
+    }
+    while (steps > 0 && !beforeFarEnd(rollDate(anchor, steps))) {
+        --steps;
+    }
+    return steps;
+}
+
+std::size_t Schedule::generate(const std::span<year_month_day> unadjusted) const {
+    requireCapacity(unadjusted, size_);
+
+    const bool forward = generation_ == DateGeneration::Forward;
+    const detail::CalendarAnchor anchor{forward ? effective_ : termination_};
+
+    // Roll dates fill the anchor's side, the opposite end closes the schedule
+    for (std::size_t k = 0; k < rolls_; ++k) {
+        const std::size_t position = forward ? k : size_ - 1 - k;
+        unadjusted[position] = rollDate(anchor, static_cast<std::int64_t>(k));
+    }
+    unadjusted[forward ? size_ - 1 : 0] = forward ? termination_ : effective_;
+    return size_;
+}
+
+std::size_t Schedule::generate(const std::span<year_month_day> unadjusted,
+                               const std::span<year_month_day> adjusted,
+                               const HolidayCalendar& calendar, const WeekendMask weekend) const {
+    requireCapacity(adjusted, size_);
+    generate(unadjusted);
+
+    for (std::size_t i = 0; i < size_; ++i) {
+        adjusted[i] = adjust(unadjusted[i], convention_, calendar, weekend);
+    }
+    return size_;
+}
+
+std::size_t Schedule::generate(const std::span<year_month_day> unadjusted,
+                               const std::span<year_month_day> adjusted,
+                               const CompiledCalendar& calendar) const {
+    requireCapacity(adjusted, size_);
+    generate(unadjusted);
+
+    for (std::size_t i = 0; i < size_; ++i) {
+        adjusted[i] = calendar.adjust(unadjusted[i], convention_);
+    }
+    return size_;
+}
+
+} // namespace datelib
@@ -0,0 +1,26 @@
+#include "datelib/TenorCache.h"
+
+namespace datelib {
+
+std::expected<Period, Error> TenorCache::intern(const std::string_view period_str,
+                                                const std::uint64_t key,
+                                                const std::size_t slot) noexcept {
+    const auto period = Period::tryParse(period_str);
+    if (period && size_ < MAX_ENTRIES) {
+        entries_[slot] = Entry{key, period->value(), static_cast<std::uint8_t>(period->unit()),
+                               static_cast<std::uint8_t>(period_str.size())};
+        ++size_;
+    }
+    return period;
+}
+
+Period TenorCache::resolve(const std::string_view period_str) {
+    const auto period = tryResolve(period_str);
+    if (period) {
+        return *period;
+    }
+    // Parse again for the detailed message; only invalid strings get here
+    return Period::parse(period_str);
+}
+
+} // namespace datelib
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "datelib/BusinessDate.h"
+#include "datelib/date.h"
+#include "datelib/error.h"
+#include "datelib/exceptions.h"
+
+#include <expected>
+#include <string>
+#include <string_view>
+
+#include "probes.h"
+
+namespace datelib::detail {
+
+// Maximum number of consecutive non-business days to search through (one year)
+inline constexpr int MAX_DAYS_TO_SEARCH = 366;
+
+// Last day of the first half of a month, for HalfMonthModifiedFollowing
+inline constexpr unsigned HALF_MONTH_DAY = 15;
+
+/**
+ * @brief Number of days the business day searches look through on each side of a date
+ */
+struct SearchReach {
+    int following = MAX_DAYS_TO_SEARCH;
+    int preceding = MAX_DAYS_TO_SEARCH;
+};
+
+/**
+ * @brief Adjust a date that is not a business day according to a business day convention
+ * @param date The date to adjust
+ * @param convention The business day convention
+ * @param reach How far next and previous search; Nearest treats a side where nothing was found
+ *        as having a business day just beyond its reach
+ * @param next Returns the first business day after date, as std::expected<BusinessDate, Error>
+ * @param previous Returns the last business day before date, likewise
+ *
+ * Every calendar type adjusts through this function, so that the conventions mean the same for
+ * all of them; only the searches differ.
+ */
+template <typename Next, typename Previous>
+std::expected<BusinessDate, Error> applyConvention(const BusinessDate date,
+                                                   const BusinessDayConvention convention,
+                                                   const SearchReach reach, Next&& next,
+                                                   Previous&& previous) {
+    using enum BusinessDayConvention;
+    switch (convention) {
+    case Following:
+        return next();
+
+    case ModifiedFollowing: {
+        auto adjusted = next();
+        // If we crossed into a new month, go backward instead
+        if (adjusted && adjusted->month() != date.month()) {
+            adjusted = previous();
+        }
+        return adjusted;
+    }
+
+    case Preceding:
+        return previous();
+
+    case ModifiedPreceding: {
+        auto adjusted = previous();
+        // If we crossed into a different month, go forward instead
+        if (adjusted && adjusted->month() != date.month()) {
+            adjusted = next();
+        }
+        return adjusted;
+    }
+
+    case Unadjusted:
+        // Return the date unchanged
+        return date;
+
+    case Nearest: {
+        // The following day wins a tie. A side without a business day in reach may still have
+        // one just beyond it, which a farther business day on the other side must not beat
+        const auto following = next();
+        const auto preceding = previous();
+        const int after = following ? *following - date : reach.following + 1;
+        const int before = preceding ? date - *preceding : reach.preceding + 1;
+        if (preceding && before < after) {
+            return preceding;
+        }
+        if (following && after <= before) {
+            return following;
+        }
+        return std::unexpected(Error{ErrorCode::NearestBusinessDayNotFound});
+    }
+
+    case HalfMonthModifiedFollowing: {
+        auto adjusted = next();
+        // Go backward instead if we crossed into a new month or past the middle of the month
+        if (adjusted && (adjusted->month() != date.month() ||
+                         (date.day() <= HALF_MONTH_DAY && adjusted->day() > HALF_MONTH_DAY))) {
+            adjusted = previous();
+        }
+        return adjusted;
+    }
+    }
+
+    // This should never be reached as all enum values are handled above
+    // If we reach here, it's a logic error (e.g., uninitialized enum)
+    return std::unexpected(Error{ErrorCode::UnhandledConvention});
+}
+
+/**
+ * @brief Throw the exception the throwing API uses for a business day error
+ * @param error The error to throw
+ * @param date The date of the failed call, passed on to the search_exception probe
+ * @param convention The convention of the failed call, likewise
+ * @param message The exception message, when it should differ from the error's own
+ *
+ * Invalid dates are reported by each function with its own message, before this is reached.
+ */
+[[noreturn]] inline void throwError(const Error error, [[maybe_unused]] const BusinessDate date,
+                                    [[maybe_unused]] const BusinessDayConvention convention,
+                                    const std::string_view message = {}) {
+    const std::string text{message.empty() ? error.message() : message};
+    if (error.code() == ErrorCode::UnhandledConvention) {
+        throw UnhandledEnumException(text);
+    }
+    DATELIB_PROBE(search_exception, date.serial(), static_cast<int>(convention),
+                  static_cast<int>(error.code()));
+    throw BusinessDaySearchException(text);
+}
+
+/**
+ * @brief Unwrap a result of the non-throwing functions, throwing on error
+ */
+inline BusinessDate valueOrThrow(const std::expected<BusinessDate, Error>& result,
+                                 const BusinessDate date, const BusinessDayConvention convention) {
+    if (!result) {
+        throwError(result.error(), date, convention);
+    }
+    return *result;
+}
+
+} // namespace datelib::detail
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "datelib/BusinessDate.h"
+#include "datelib/HolidayCalendar.h"
+#include "datelib/date_util.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#include "business_day_conventions.h"
+
+namespace datelib::detail {
+
+// Number of days in one bitmap word
+inline constexpr int DAYS_PER_WORD = 64;
+
+// Number of days in a week
+inline constexpr unsigned DAYS_PER_WEEK = 7;
+
+/**
+ * @brief Weekend days of the 64 days starting at a given weekday, one bit per day
+ */
+inline std::uint64_t weekendWord(const WeekendMask weekend, const unsigned first_weekday) {
+    // Rotate the weekly mask so that bit 0 is first_weekday, then repeat it across the word
+    const unsigned bits = weekend.bits();
+    std::uint64_t word =
+        ((bits >> first_weekday) | (bits << (DAYS_PER_WEEK - first_weekday))) & 0x7FU;
+    word |= word << 7;
+    word |= word << 14;
+    word |= word << 28;
+    word |= word << 56;
+    return word;
+}
+
+/**
+ * @brief Reads the year bitmaps of a HolidayCalendar for the business day walks
+ */
+struct HolidayWords {
+    const HolidayCalendar& calendar;
+
+    [[nodiscard]] std::uint64_t operator()(const int year, const std::size_t word_index) const {
+        return calendar.yearBitmap(year).words[word_index];
+    }
+};
+
+/**
+ * @brief Outcome of addBusinessDays()
+ */
+struct BusinessDayWalk {
+    // The date reached, or the last day looked at when found is false
+    BusinessDate reached;
+    bool found;
+};
+
+/**
+ * @brief Add a number of business days to a date, 64 days of the year bitmaps at a time
+ * @param start The starting date
+ * @param count Number of business days to add (can be negative)
+ * @param weekend The weekdays considered as weekend
+ * @param holiday_word Callable (int year, std::size_t word_index) returning the holidays of days
+ *        64 * word_index to 64 * word_index + 63 of the year, bit 0 first
+ *
+ * Whole words of business days are counted with a popcount, so the cost grows with the number of
+ * words crossed rather than of days. Like a day by day walk, it gives up when more than
+ * MAX_DAYS_TO_SEARCH days follow a business day (or the start) without another one.
+ */
+template <typename HolidayWord>
+BusinessDayWalk addBusinessDays(const BusinessDate start, const int count,
+                                const WeekendMask weekend, HolidayWord&& holiday_word) {
+    if (count == 0) {
+        return {start, true};
+    }
+
+    const bool forward = count > 0;
+    int remaining = std::abs(count);
+    // The last business day passed, or the start
+    BusinessDate last = start;
+
+    int year = start.year();
+    BusinessDate year_start = BusinessDate::fromSerial(BusinessDate::serialOf(year, 1, 1));
+    int year_days = BusinessDate::serialOf(year + 1, 1, 1) - year_start.serial();
+    // Day of the year looked at next
+    int day = (start - year_start) + (forward ? 1 : -1);
+
+    while (true) {
+        if (day >= year_days) {
+            ++year;
+            year_start += year_days;
+            year_days = BusinessDate::serialOf(year + 1, 1, 1) - year_start.serial();
+            day = 0;
+        } else if (day < 0) {
+            --year;
+            const BusinessDate next_year_start = year_start;
+            year_start = BusinessDate::fromSerial(BusinessDate::serialOf(year, 1, 1));
+            year_days = next_year_start - year_start;
+            day = year_days - 1;
+        }
+
+        const auto word_index = static_cast<std::size_t>(day / DAYS_PER_WORD);
+        const auto bit = static_cast<unsigned>(day % DAYS_PER_WORD);
+        const BusinessDate word_start =
+            year_start + static_cast<BusinessDate::rep>(word_index) * DAYS_PER_WORD;
+        const int word_days = std::min(DAYS_PER_WORD, year_days - (word_start - year_start));
+
+        // Business days of the word from day on (forward) or up to day (backward)
+        std::uint64_t open = ~(holiday_word(year, word_index) |
+                               weekendWord(weekend, word_start.weekday().c_encoding()));
+        if (word_days < DAYS_PER_WORD) {
+            open &= (std::uint64_t{1} << word_days) - 1;
+        }
+        open &= forward ? ~std::uint64_t{0} << bit
+                        : ~std::uint64_t{0} >> (DAYS_PER_WORD - 1 - bit);
+
+        if (open != 0) {
+            // Later business days of the word are less than a word apart; only the first one can
+            // be too far from the last one passed
+            const int lowest = std::countr_zero(open);
+            const int highest = DAYS_PER_WORD - 1 - std::countl_zero(open);
+            const BusinessDate first = word_start + (forward ? lowest : highest);
+            if (std::abs(first - last) > MAX_DAYS_TO_SEARCH) {
+                break;
+            }
+
+            const int in_word = std::popcount(open);
+            if (in_word >= remaining) {
+                // Drop the business days before the wanted one, nearest first
+                for (int skip = remaining - 1; skip > 0; --skip) {
+                    if (forward) {
+                        open &= open - 1;
+                    } else {
+                        open ^= std::uint64_t{1} << (DAYS_PER_WORD - 1 - std::countl_zero(open));
+                    }
+                }
+                const int wanted =
+                    forward ? std::countr_zero(open) : DAYS_PER_WORD - 1 - std::countl_zero(open);
+                return {word_start + wanted, true};
+            }
+            remaining -= in_word;
+            last = word_start + (forward ? highest : lowest);
+        }
+
+        // Give up once the scan has passed MAX_DAYS_TO_SEARCH days after the last business day
+        const BusinessDate scanned = forward ? word_start + (word_days - 1) : word_start;
+        if (std::abs(scanned - last) >= MAX_DAYS_TO_SEARCH) {
+            break;
+        }
+        day = forward ? static_cast<int>(word_index + 1) * DAYS_PER_WORD
+                      : static_cast<int>(word_index) * DAYS_PER_WORD - 1;
+    }
+
+    return {last + (forward ? MAX_DAYS_TO_SEARCH : -MAX_DAYS_TO_SEARCH), false};
+}
+
+} // namespace datelib::detail
@@ -1,258 +1,422 @@
 #include "datelib/date.h"
 
+#include "datelib/CompiledCalendar.h"
 #include "datelib/HolidayCalendar.h"
 #include "datelib/period.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+
+#include "business_day_conventions.h"
+#include "business_day_words.h"
+#include "date_arithmetic.h"
+#include "probes.h"
+#include "stats_counters.h"
+
 namespace datelib {
 
 namespace {
-// Maximum number of days to search for a business day (one year)
-constexpr int MAX_DAYS_TO_SEARCH = 366;
+using detail::MAX_DAYS_TO_SEARCH;
+
+// Batches whose dates are this many years apart or more (say, with a 9999-12-31 sentinel) are
+// looked up date by date instead of compiling every year in between
+constexpr int MAX_BATCH_YEARS = 200;
 
 /**
  * @brief Move forward to the next business day
  */
-std::chrono::year_month_day
-moveToNextBusinessDay(const std::chrono::year_month_day& start, const HolidayCalendar& calendar,
-                      const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) {
-    auto adjusted = std::chrono::sys_days{start};
-    std::chrono::year_month_day adjusted_ymd{adjusted};
+std::expected<BusinessDate, Error> moveToNextBusinessDay(BusinessDate start,
+                                                         const HolidayCalendar& calendar,
+                                                         const WeekendMask weekend) {
     int iterations = 0;
 
-    while (!isBusinessDay(adjusted_ymd, calendar, weekend_days)) {
+    while (!isBusinessDay(start, calendar, weekend)) {
         if (++iterations > MAX_DAYS_TO_SEARCH) {
-            throw BusinessDaySearchException(
-                "Unable to find next business day within reasonable range");
+            detail::countStat(stats::Counter::NextBusinessDaySteps, MAX_DAYS_TO_SEARCH);
+            DATELIB_PROBE(search_failed, start.serial(),
+                          static_cast<int>(ErrorCode::NextBusinessDayNotFound), MAX_DAYS_TO_SEARCH);
+            return std::unexpected(Error{ErrorCode::NextBusinessDayNotFound});
         }
-        adjusted += std::chrono::days{1};
-        adjusted_ymd = std::chrono::year_month_day{adjusted};
+        ++start;
     }
 
-    return adjusted_ymd;
+    detail::countStat(stats::Counter::NextBusinessDaySteps,
+                      static_cast<std::uint64_t>(iterations));
+    return start;
 }
 
 /**
  * @brief Move backward to the previous business day
  */
-std::chrono::year_month_day moveToPreviousBusinessDay(
-    const std::chrono::year_month_day& start, const HolidayCalendar& calendar,
-    const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) {
-    auto adjusted = std::chrono::sys_days{start};
-    std::chrono::year_month_day adjusted_ymd{adjusted};
+std::expected<BusinessDate, Error> moveToPreviousBusinessDay(BusinessDate start,
+                                                             const HolidayCalendar& calendar,
+                                                             const WeekendMask weekend) {
     int iterations = 0;
 
-    while (!isBusinessDay(adjusted_ymd, calendar, weekend_days)) {
+    while (!isBusinessDay(start, calendar, weekend)) {
         if (++iterations > MAX_DAYS_TO_SEARCH) {
-            throw BusinessDaySearchException(
-                "Unable to find previous business day within reasonable range");
+            detail::countStat(stats::Counter::PreviousBusinessDaySteps, MAX_DAYS_TO_SEARCH);
+            DATELIB_PROBE(search_failed, start.serial(),
+                          static_cast<int>(ErrorCode::PreviousBusinessDayNotFound),
+                          MAX_DAYS_TO_SEARCH);
+            return std::unexpected(Error{ErrorCode::PreviousBusinessDayNotFound});
         }
-        adjusted -= std::chrono::days{1};
-        adjusted_ymd = std::chrono::year_month_day{adjusted};
+        --start;
     }
 
-    return adjusted_ymd;
+    detail::countStat(stats::Counter::PreviousBusinessDaySteps,
+                      static_cast<std::uint64_t>(iterations));
+    return start;
 }
 
 /**
- * @brief Add a number of business days to a date
+ * @brief Add a number of business days to a date, a word of the year bitmaps at a time
  * @param start The starting date
  * @param num_business_days Number of business days to add (can be negative)
  * @param calendar The holiday calendar
- * @param weekend_days The set of weekdays considered as weekend
+ * @param weekend The weekdays considered as weekend
  * @return The date after adding the specified number of business days
  */
-std::chrono::year_month_day
-addBusinessDays(const std::chrono::year_month_day& start, int num_business_days,
-                const HolidayCalendar& calendar,
-                const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) {
-    if (num_business_days == 0) {
-        return start;
+std::expected<BusinessDate, Error> addBusinessDays(const BusinessDate start,
+                                                   const int num_business_days,
+                                                   const HolidayCalendar& calendar,
+                                                   const WeekendMask weekend) {
+    const auto walk = detail::addBusinessDays(start, num_business_days, weekend,
+                                              detail::HolidayWords{calendar});
+    // The walk covers every calendar day between the start and the day it reached
+    detail::countStat(stats::Counter::AddBusinessDaysSteps,
+                      static_cast<std::uint64_t>(std::abs(walk.reached - start)));
+    if (!walk.found) {
+        DATELIB_PROBE(search_failed, start.serial(),
+                      static_cast<int>(ErrorCode::BusinessDaysNotReached),
+                      std::abs(walk.reached - start));
+        return std::unexpected(Error{ErrorCode::BusinessDaysNotReached});
     }
+    return walk.reached;
+}
 
-    auto current = std::chrono::sys_days{start};
-    std::chrono::year_month_day current_ymd{current};
-    int days_added = 0;
-    int direction = (num_business_days > 0) ? 1 : -1;
-    int target = std::abs(num_business_days);
-    int iterations = 0;
+/**
+ * @brief Adjust a serial date, reporting failures as an Error
+ */
+std::expected<BusinessDate, Error> adjustSerial(const BusinessDate date,
+                                                const BusinessDayConvention convention,
+                                                const HolidayCalendar& calendar,
+                                                const WeekendMask weekend) {
+    // If already a business day, no adjustment needed
+    if (isBusinessDay(date, calendar, weekend)) {
+        return date;
+    }
 
-    while (days_added < target) {
-        if (++iterations > MAX_DAYS_TO_SEARCH) {
-            throw BusinessDaySearchException("Unable to add business days within reasonable range");
-        }
+    return detail::applyConvention(
+        date, convention, detail::SearchReach{},
+        [&] { return moveToNextBusinessDay(date, calendar, weekend); },
+        [&] { return moveToPreviousBusinessDay(date, calendar, weekend); });
+}
 
-        // Move one calendar day in the appropriate direction
-        current += std::chrono::days{direction};
-        current_ymd = std::chrono::year_month_day{current};
+/**
+ * @brief Advance a serial date, reporting failures as an Error
+ */
+std::expected<BusinessDate, Error> advanceSerial(const BusinessDate date, const Period& period,
+                                                 const BusinessDayConvention convention,
+                                                 const HolidayCalendar& calendar,
+                                                 const WeekendMask weekend) {
+    // Business days already account for holidays, so return directly without further adjustment
+    if (period.unit() == Period::Unit::Days) {
+        return addBusinessDays(date, period.value(), calendar, weekend);
+    }
 
-        // Check if this is a business day
-        if (isBusinessDay(current_ymd, calendar, weekend_days)) {
-            days_added++;
-        }
+    // Advance by weeks, months or years, then apply the business day convention
+    const std::chrono::year_month_day result_date =
+        detail::addCalendarPeriod(date.toYearMonthDay(), period);
+    return adjustSerial(BusinessDate{result_date}, convention, calendar, weekend);
+}
+
+/**
+ * @brief adjustSerial() between the adjust_entry and adjust_return probes
+ */
+std::expected<BusinessDate, Error> tryAdjustSerial(const BusinessDate date,
+                                                   const BusinessDayConvention convention,
+                                                   const HolidayCalendar& calendar,
+                                                   const WeekendMask weekend) {
+    DATELIB_PROBE(adjust_entry, date.serial(), static_cast<int>(convention));
+    const auto adjusted = adjustSerial(date, convention, calendar, weekend);
+    DATELIB_PROBE(adjust_return, date.serial(), static_cast<int>(convention),
+                  adjusted.value_or(date).serial(), adjusted ? std::abs(*adjusted - date) : -1);
+    return adjusted;
+}
+
+/**
+ * @brief advanceSerial() between the advance_entry and advance_return probes
+ */
+std::expected<BusinessDate, Error> tryAdvanceSerial(const BusinessDate date, const Period& period,
+                                                    const BusinessDayConvention convention,
+                                                    const HolidayCalendar& calendar,
+                                                    const WeekendMask weekend) {
+    DATELIB_PROBE(advance_entry, date.serial(), period.value(), static_cast<int>(period.unit()),
+                  static_cast<int>(convention));
+    const auto advanced = advanceSerial(date, period, convention, calendar, weekend);
+    DATELIB_PROBE(advance_return, date.serial(), static_cast<int>(convention),
+                  advanced.value_or(date).serial(), advanced ? std::abs(*advanced - date) : -1);
+    return advanced;
+}
+
+/**
+ * @brief Get a compiled calendar for the years spanned by a batch of dates
+ * @param margin Extra years to include on each side, for searches leaving the batch's years
+ * @return The calendar's shared snapshot, or nullptr when the dates are more than
+ *         MAX_BATCH_YEARS years apart and should be looked up one by one instead
+ */
+std::shared_ptr<const CompiledCalendar>
+compileForBatch(const std::span<const std::chrono::sys_days> dates,
+                const HolidayCalendar& calendar, const WeekendMask weekend, const int margin) {
+    const auto [earliest, latest] = std::ranges::minmax(dates);
+    const int min_year = static_cast<int>(std::chrono::year_month_day{earliest}.year());
+    const int max_year = static_cast<int>(std::chrono::year_month_day{latest}.year());
+    if (max_year - min_year >= MAX_BATCH_YEARS) {
+        return nullptr;
     }
 
-    return current_ymd;
+    // Keep the margin inside the range of years a calendar can be compiled for
+    constexpr int lowest_year = static_cast<int>(std::chrono::year::min());
+    constexpr int highest_year = static_cast<int>(std::chrono::year::max()) - 1;
+    const int first_year = std::max(min_year - margin, lowest_year);
+    const int last_year = std::min(max_year + margin, highest_year);
+    return calendar.compileShared(first_year, last_year, weekend);
 }
 } // namespace
 
 bool isBusinessDay(const std::chrono::year_month_day& date, const HolidayCalendar& calendar,
-                   const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) {
+                   const WeekendMask weekend) {
     // Validate the date is well-formed
     if (!date.ok()) {
         throw std::invalid_argument("Invalid date provided to isBusinessDay");
     }
 
-    // Convert to sys_days to get the weekday
-    const auto sys_days_date = std::chrono::sys_days{date};
-    std::chrono::weekday wd{sys_days_date};
-
-    // Check if the day is not a weekend day
-    const bool is_not_weekend = !weekend_days.contains(wd);
+    return isBusinessDay(BusinessDate{date}, calendar, weekend);
+}
 
+bool isBusinessDay(const BusinessDate date, const HolidayCalendar& calendar,
+                   const WeekendMask weekend) {
     // A business day is not a weekend day and not a holiday
-    return is_not_weekend && !calendar.isHoliday(date);
+    return !weekend.contains(date.weekday()) && !calendar.isHoliday(date);
 }
 
-std::chrono::year_month_day
-adjust(const std::chrono::year_month_day& date, const BusinessDayConvention convention,
-       const HolidayCalendar& calendar,
-       const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) {
-    // Validate the input date
-    if (!date.ok()) {
-        throw std::invalid_argument("Invalid date provided to adjust");
+void isBusinessDay(const std::span<const std::chrono::sys_days> dates,
+                   const std::span<std::uint8_t> out, const HolidayCalendar& calendar,
+                   const WeekendMask weekend) {
+    if (out.size() != dates.size()) {
+        throw std::invalid_argument("Output span must have the same size as the input dates");
+    }
+    if (dates.empty()) {
+        return;
     }
 
-    // If already a business day, no adjustment needed
-    if (isBusinessDay(date, calendar, weekend_days)) {
-        return date;
+    if (const auto compiled = compileForBatch(dates, calendar, weekend, 0)) {
+        compiled->isBusinessDay(dates, out);
+        return;
     }
+    std::ranges::transform(dates, out.begin(), [&](const std::chrono::sys_days date) {
+        return static_cast<std::uint8_t>(isBusinessDay(BusinessDate{date}, calendar, weekend));
+    });
+}
 
-    // Apply the convention
-    using enum BusinessDayConvention;
-    switch (convention) {
-    case Following:
-        return moveToNextBusinessDay(date, calendar, weekend_days);
-
-    case ModifiedFollowing: {
-        auto adjusted = moveToNextBusinessDay(date, calendar, weekend_days);
-        // If we crossed into a new month, go backward instead
-        if (adjusted.month() != date.month()) {
-            adjusted = moveToPreviousBusinessDay(date, calendar, weekend_days);
-        }
-        return adjusted;
+void adjust(const std::span<const std::chrono::sys_days> dates,
+            const std::span<std::chrono::sys_days> out, const BusinessDayConvention convention,
+            const HolidayCalendar& calendar, const WeekendMask weekend) {
+    if (out.size() != dates.size()) {
+        throw std::invalid_argument("Output span must have the same size as the input dates");
+    }
+    if (dates.empty()) {
+        return;
     }
 
-    case Preceding:
-        return moveToPreviousBusinessDay(date, calendar, weekend_days);
+    // One year on each side covers any search the scalar adjust could complete. The compiled
+    // calendar fires the batch probes itself
+    if (const auto compiled = compileForBatch(dates, calendar, weekend, 1)) {
+        compiled->adjust(dates, out, convention);
+        return;
+    }
 
-    case ModifiedPreceding: {
-        auto adjusted = moveToPreviousBusinessDay(date, calendar, weekend_days);
-        // If we crossed into a different month, go forward instead
-        if (adjusted.month() != date.month()) {
-            adjusted = moveToNextBusinessDay(date, calendar, weekend_days);
-        }
-        return adjusted;
+    DATELIB_PROBE(adjust_batch_entry, dates.size(), static_cast<int>(convention));
+    [[maybe_unused]] std::size_t moved = 0;
+    for (std::size_t i = 0; i < dates.size(); ++i) {
+        const std::chrono::sys_days date = dates[i];
+        out[i] = adjust(BusinessDate{date}, convention, calendar, weekend).toSysDays();
+        moved += out[i] != date ? 1 : 0;
     }
+    DATELIB_PROBE(adjust_batch_return, dates.size(), static_cast<int>(convention), moved);
+}
 
-    case Unadjusted:
-        // Return the date unchanged
-        return date;
+std::expected<std::chrono::year_month_day, Error>
+tryAdjust(const std::chrono::year_month_day& date, const BusinessDayConvention convention,
+          const HolidayCalendar& calendar, const WeekendMask weekend) {
+    // Validate the input date
+    if (!date.ok()) {
+        return std::unexpected(Error{ErrorCode::InvalidDate});
     }
 
-    // This should never be reached as all enum values are handled above
-    // If we reach here, it's a logic error (e.g., uninitialized enum)
-    throw UnhandledEnumException("Unhandled BusinessDayConvention in adjust()");
+    const auto adjusted = tryAdjustSerial(BusinessDate{date}, convention, calendar, weekend);
+    if (!adjusted) {
+        return std::unexpected(adjusted.error());
+    }
+    return adjusted->toYearMonthDay();
 }
 
-std::chrono::year_month_day
-advance(const std::chrono::year_month_day& date, const Period& period,
-        BusinessDayConvention convention, const HolidayCalendar& calendar,
-        const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) {
+std::chrono::year_month_day adjust(const std::chrono::year_month_day& date,
+                                   const BusinessDayConvention convention,
+                                   const HolidayCalendar& calendar, const WeekendMask weekend) {
+    const auto adjusted = tryAdjust(date, convention, calendar, weekend);
+    if (adjusted) {
+        return *adjusted;
+    }
+    if (adjusted.error().code() == ErrorCode::InvalidDate) {
+        throw std::invalid_argument("Invalid date provided to adjust");
+    }
+    detail::throwError(adjusted.error(), BusinessDate{date}, convention);
+}
+
+BusinessDate adjust(const BusinessDate date, const BusinessDayConvention convention,
+                    const HolidayCalendar& calendar, const WeekendMask weekend) {
+    return detail::valueOrThrow(tryAdjustSerial(date, convention, calendar, weekend), date,
+                                convention);
+}
+
+std::expected<std::chrono::year_month_day, Error>
+tryAdvance(const std::chrono::year_month_day& date, const Period& period,
+           const BusinessDayConvention convention, const HolidayCalendar& calendar,
+           const WeekendMask weekend) {
     // Validate the input date
     if (!date.ok()) {
-        throw InvalidDateException("Invalid date provided to advance");
+        return std::unexpected(Error{ErrorCode::InvalidDate});
     }
 
-    std::chrono::year_month_day result_date = date;
-
-    // Advance the date based on the period unit
-    using enum Period::Unit;
-    switch (period.unit()) {
-    case Days:
-        // For days, add business days (skipping weekends and holidays)
-        result_date = addBusinessDays(date, period.value(), calendar, weekend_days);
-        // Business days already account for holidays, so return directly without further adjustment
-        return result_date;
-
-    case Weeks:
-        // Add weeks (7 days per week)
-        result_date = std::chrono::year_month_day{std::chrono::sys_days{date} +
-                                                  std::chrono::days{period.value() * 7}};
-        break;
-
-    case Months: {
-        // Add months (calendar-aware)
-        auto y = date.year();
-        auto m = date.month();
-        auto d = date.day();
-
-        // Calculate new month/year
-        int total_months = static_cast<int>(unsigned{m}) + period.value();
-
-        // Handle month overflow/underflow
-        int year_offset = 0;
-        while (total_months > 12) {
-            total_months -= 12;
-            year_offset++;
-        }
-        while (total_months < 1) {
-            total_months += 12;
-            year_offset--;
-        }
+    const auto advanced = tryAdvanceSerial(BusinessDate{date}, period, convention, calendar,
+                                           weekend);
+    if (!advanced) {
+        return std::unexpected(advanced.error());
+    }
+    return advanced->toYearMonthDay();
+}
 
-        auto new_year = y + std::chrono::years{year_offset};
-        auto new_month = std::chrono::month{static_cast<unsigned>(total_months)};
+std::expected<std::chrono::year_month_day, Error>
+tryAdvance(const std::chrono::year_month_day& date, const std::string_view period,
+           const BusinessDayConvention convention, const HolidayCalendar& calendar,
+           const WeekendMask weekend) {
+    const auto parsed_period = Period::tryParse(period);
+    if (!parsed_period) {
+        return std::unexpected(parsed_period.error());
+    }
+    return tryAdvance(date, *parsed_period, convention, calendar, weekend);
+}
 
-        // Handle day overflow (e.g., Jan 31 + 1M = Feb 28/29, not Feb 31)
-        result_date = std::chrono::year_month_day{new_year, new_month, d};
-        if (!result_date.ok()) {
-            // Day is invalid for this month, use last day of month
-            result_date = std::chrono::year_month_day{new_year / new_month / std::chrono::last};
-        }
-        break;
+std::chrono::year_month_day advance(const std::chrono::year_month_day& date, const Period& period,
+                                    BusinessDayConvention convention,
+                                    const HolidayCalendar& calendar, const WeekendMask weekend) {
+    const auto advanced = tryAdvance(date, period, convention, calendar, weekend);
+    if (advanced) {
+        return *advanced;
+    }
+    if (advanced.error().code() == ErrorCode::InvalidDate) {
+        throw InvalidDateException("Invalid date provided to advance");
     }
+    detail::throwError(advanced.error(), BusinessDate{date}, convention);
+}
 
-    case Years: {
-        // Add years (calendar-aware)
-        auto y = date.year();
-        auto m = date.month();
-        auto d = date.day();
+BusinessDate advance(const BusinessDate date, const Period& period,
+                     const BusinessDayConvention convention, const HolidayCalendar& calendar,
+                     const WeekendMask weekend) {
+    return detail::valueOrThrow(tryAdvanceSerial(date, period, convention, calendar, weekend),
+                                date, convention);
+}
 
-        auto new_year = y + std::chrono::years{period.value()};
+std::chrono::year_month_day advance(const std::chrono::year_month_day& date,
+                                    std::string_view period, BusinessDayConvention convention,
+                                    const HolidayCalendar& calendar, const WeekendMask weekend) {
+    // Parse the period string
+    Period parsed_period = Period::parse(period);
 
-        // Handle leap year edge case (Feb 29 -> Feb 28 in non-leap year)
-        result_date = std::chrono::year_month_day{new_year, m, d};
-        if (!result_date.ok()) {
-            // Day is invalid for this year/month (e.g., Feb 29 in non-leap year)
-            result_date = std::chrono::year_month_day{new_year / m / std::chrono::last};
+    // Call the Period-based overload
+    return advance(date, parsed_period, convention, calendar, weekend);
+}
+
+std::vector<std::chrono::year_month_day> advance(const std::chrono::year_month_day& anchor,
+                                                 std::span<const Period> periods,
+                                                 BusinessDayConvention convention,
+                                                 const HolidayCalendar& calendar,
+                                                 const WeekendMask weekend) {
+    if (!anchor.ok()) {
+        throw InvalidDateException("Invalid date provided to advance");
+    }
+
+    std::vector<std::chrono::year_month_day> result(periods.size());
+    const detail::CalendarAnchor decomposed{anchor};
+
+    // Business day periods, ordered by distance from the anchor on each side
+    std::vector<std::size_t> business_day_pillars;
+    for (std::size_t i = 0; i < periods.size(); ++i) {
+        if (periods[i].unit() == Period::Unit::Days) {
+            business_day_pillars.push_back(i);
+            continue;
         }
-        break;
+        const BusinessDate shifted{detail::addCalendarPeriod(decomposed, periods[i])};
+        result[i] = adjust(shifted, convention, calendar, weekend).toYearMonthDay();
     }
+    std::ranges::sort(business_day_pillars, [&](const std::size_t lhs, const std::size_t rhs) {
+        return std::abs(periods[lhs].value()) < std::abs(periods[rhs].value());
+    });
+
+    // The Nth business day is the (N - M)th after the Mth, so each pillar walks on from the
+    // previous one on its side of the anchor instead of from the anchor again
+    BusinessDate forward{anchor};
+    BusinessDate backward{anchor};
+    int forward_count = 0;
+    int backward_count = 0;
+    for (const std::size_t i : business_day_pillars) {
+        const int count = periods[i].value();
+        if (count >= 0) {
+            forward = detail::valueOrThrow(
+                addBusinessDays(forward, count - forward_count, calendar, weekend), forward,
+                convention);
+            forward_count = count;
+            result[i] = forward.toYearMonthDay();
+        } else {
+            backward = detail::valueOrThrow(
+                addBusinessDays(backward, count - backward_count, calendar, weekend), backward,
+                convention);
+            backward_count = count;
+            result[i] = backward.toYearMonthDay();
+        }
     }
 
-    // Apply business day convention to the result
-    return adjust(result_date, convention, calendar, weekend_days);
+    return result;
+}
+
+bool isBusinessDay(const std::chrono::year_month_day& date, const HolidayCalendar& calendar,
+                   const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) {
+    return isBusinessDay(date, calendar, WeekendMask{weekend_days});
 }
 
 std::chrono::year_month_day
-advance(const std::chrono::year_month_day& date, std::string_view period,
+adjust(const std::chrono::year_month_day& date, const BusinessDayConvention convention,
+       const HolidayCalendar& calendar,
+       const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) {
+    return adjust(date, convention, calendar, WeekendMask{weekend_days});
+}
+
+std::chrono::year_month_day
+advance(const std::chrono::year_month_day& date, const Period& period,
         BusinessDayConvention convention, const HolidayCalendar& calendar,
         const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) {
-    // Parse the period string
-    Period parsed_period = Period::parse(period);
+    return advance(date, period, convention, calendar, WeekendMask{weekend_days});
+}
 
-    // Call the Period-based overload
-    return advance(date, parsed_period, convention, calendar, weekend_days);
+std::chrono::year_month_day
+advance(const std::chrono::year_month_day& date, std::string_view period,
+        BusinessDayConvention convention, const HolidayCalendar& calendar,
+        const std::unordered_set<std::chrono::weekday, WeekdayHash>& weekend_days) {
+    return advance(date, period, convention, calendar, WeekendMask{weekend_days});
 }
 
 } // namespace datelib
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "datelib/period.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace datelib::detail {
+
+/**
+ * @brief A start date decomposed once for repeated calendar shifts
+ *
+ * Shifting the same date by many periods (e.g. all the pillars of a curve) only needs the
+ * serial day number, the absolute month count and the day of month; computing them up front
+ * keeps each individual shift to a few integer operations.
+ */
+struct CalendarAnchor {
+    explicit CalendarAnchor(const std::chrono::year_month_day& date)
+        : serial{date},
+          month_index{std::int64_t{static_cast<int>(date.year())} * 12 +
+                      static_cast<int>(unsigned{date.month()}) - 1},
+          day{date.day()} {}
+
+    std::chrono::sys_days serial;
+    // Months since January of year 0
+    std::int64_t month_index;
+    std::chrono::day day;
+};
+
+/**
+ * @brief Shift an anchor by a number of months, keeping its day of month
+ *
+ * The day is clamped to the last day of the target month when it is shorter
+ * (e.g. Jan 31 + 1M = Feb 28/29).
+ */
+inline std::chrono::year_month_day addMonths(const CalendarAnchor& anchor,
+                                             const std::int64_t months) {
+    const std::int64_t target = anchor.month_index + months;
+
+    // Floor division, so that months before year 0 map to the right year
+    std::int64_t year_index = target / 12;
+    std::int64_t month_offset = target % 12;
+    if (month_offset < 0) {
+        month_offset += 12;
+        --year_index;
+    }
+
+    const std::chrono::year new_year{static_cast<int>(year_index)};
+    const std::chrono::month new_month{static_cast<unsigned>(month_offset + 1)};
+    const std::chrono::day last_day = (new_year / new_month / std::chrono::last).day();
+    return {new_year, new_month, std::min(anchor.day, last_day)};
+}
+
+/**
+ * @brief Shift a decomposed date by a calendar-based period (weeks, months or years)
+ * @param anchor The starting date, decomposed
+ * @param period The period to add; its unit must not be Days
+ * @return The shifted, unadjusted date
+ *
+ * Month and year shifts keep the day of month, clamping to the last day of the target month
+ * when it is shorter (e.g. Jan 31 + 1M = Feb 28/29, Feb 29 + 1Y = Feb 28).
+ * Business-day periods (Days) depend on a calendar and are handled by the callers.
+ */
+inline std::chrono::year_month_day addCalendarPeriod(const CalendarAnchor& anchor,
+                                                     const Period& period) {
+    using enum Period::Unit;
+    switch (period.unit()) {
+    case Days:
+        // Business days are not a calendar shift
+        break;
+
+    case Weeks:
+        // Add weeks (7 days per week)
+        return std::chrono::year_month_day{anchor.serial +
+                                           std::chrono::days{std::int64_t{period.value()} * 7}};
+
+    case Months:
+        return addMonths(anchor, period.value());
+
+    case Years:
+        // A year is twelve months, including the Feb 29 -> Feb 28 clamp in non-leap years
+        return addMonths(anchor, std::int64_t{period.value()} * 12);
+    }
+
+    return std::chrono::year_month_day{anchor.serial};
+}
+
+/**
+ * @brief Shift a date by a calendar-based period (weeks, months or years)
+ * @param date The starting date (must be valid)
+ * @param period The period to add; its unit must not be Days
+ * @return The shifted, unadjusted date
+ */
+inline std::chrono::year_month_day addCalendarPeriod(const std::chrono::year_month_day& date,
+                                                     const Period& period) {
+    return addCalendarPeriod(CalendarAnchor{date}, period);
+}
+
+} // namespace datelib::detail
@@ -0,0 +1,97 @@
+#pragma once
+
+/**
+ * @file probes.h
+ * @brief USDT (Linux SDT) static tracepoints on the datelib hot paths
+ *
+ * DATELIB_PROBE(name, args...) places a probe "datelib:name" with up to four integer arguments.
+ * Each probe is a single nop instruction plus an ELF note (.note.stapsdt) that tells tracers
+ * where it is and where its arguments live, in the format of systemtap's <sys/sdt.h>; nothing
+ * is linked in and nothing runs unless a tracer such as bpftrace attaches, e.g.
+ *
+ *   bpftrace -e 'usdt:./libdatelib.so:datelib:adjust_return /arg3 > 5/ { printf("%d\n", arg0); }'
+ *
+ * Probes are compiled in when datelib is built with DATELIB_ENABLE_PROBES for x86-64 or AArch64
+ * Linux with GCC or Clang; elsewhere DATELIB_PROBE expands to nothing.
+ *
+ * Probes in this library:
+ * - adjust_entry(date, convention) and adjust_return(date, convention, adjusted, displacement),
+ *   displacement being the calendar days between date and adjusted, or -1 when no business day
+ *   was found; the throwing CompiledCalendar functions skip the return probe on failure
+ * - advance_entry(date, period_value, period_unit, convention) and
+ *   advance_return(date, convention, result, displacement), likewise
+ * - adjust_batch_entry(count, convention) and adjust_batch_return(count, convention, moved) once
+ *   per batch adjust, moved being the number of dates that changed
+ * - is_holiday_entry(date) and is_holiday_return(date, is_holiday)
+ * - get_holidays_entry(year) and get_holidays_return(year, count)
+ * - search_failed(start, error_code, days_searched) where a business day search gives up
+ * - search_exception(date, convention, error_code) before every BusinessDaySearchException,
+ *   all of which are thrown by detail::throwError()
+ *
+ * Dates are BusinessDate serials (days since 1970-01-01), conventions and period units the
+ * values of their enumerators and error codes those of ErrorCode.
+ */
+
+#if defined(DATELIB_ENABLE_PROBES) && defined(__linux__) && defined(__GNUC__) &&                   \
+    (defined(__x86_64__) || defined(__aarch64__))
+
+#include <type_traits>
+
+#define DATELIB_SDT_STR(x) #x
+#define DATELIB_SDT_ASM_1(x) DATELIB_SDT_STR(x) "\n"
+#define DATELIB_SDT_ASM_3(a, b, c)                                                                 \
+    DATELIB_SDT_STR(a) "," DATELIB_SDT_STR(b) "," DATELIB_SDT_STR(c) "\n"
+#define DATELIB_SDT_ASM_STRING(x) DATELIB_SDT_ASM_1(.asciz DATELIB_SDT_STR(x))
+
+// Argument n is described as "<size>@<operand>", the size negative for a signed type; %n prints
+// the negated size constant. Integer arguments only
+#define DATELIB_SDT_SIZE(x)                                                                        \
+    ((std::is_signed_v<std::remove_cvref_t<decltype(x)>> ? 1 : -1) *                               \
+     static_cast<int>(sizeof(x)))
+#define DATELIB_SDT_OPERAND(no, x)                                                                 \
+    [DATELIB_SDT_S##no] "n"(DATELIB_SDT_SIZE(x)), [DATELIB_SDT_A##no] "nor"(x)
+#define DATELIB_SDT_FORMAT(no) %n[DATELIB_SDT_S##no]@%[DATELIB_SDT_A##no]
+
+#define DATELIB_SDT_FORMATS_1 DATELIB_SDT_FORMAT(1)
+#define DATELIB_SDT_FORMATS_2 DATELIB_SDT_FORMATS_1 DATELIB_SDT_FORMAT(2)
+#define DATELIB_SDT_FORMATS_3 DATELIB_SDT_FORMATS_2 DATELIB_SDT_FORMAT(3)
+#define DATELIB_SDT_FORMATS_4 DATELIB_SDT_FORMATS_3 DATELIB_SDT_FORMAT(4)
+
+#define DATELIB_SDT_OPERANDS_1(a) DATELIB_SDT_OPERAND(1, a)
+#define DATELIB_SDT_OPERANDS_2(a, b) DATELIB_SDT_OPERANDS_1(a), DATELIB_SDT_OPERAND(2, b)
+#define DATELIB_SDT_OPERANDS_3(a, b, c) DATELIB_SDT_OPERANDS_2(a, b), DATELIB_SDT_OPERAND(3, c)
+#define DATELIB_SDT_OPERANDS_4(a, b, c, d)                                                         \
+    DATELIB_SDT_OPERANDS_3(a, b, c), DATELIB_SDT_OPERAND(4, d)
+
+// The note records the probe address (label 990), no base address and no semaphore. "?" puts
+// it in the section group of the function, so that it goes when an inline copy is discarded
+#define DATELIB_SDT_PROBE(name, n, ...)                                                            \
+    __asm__ __volatile__(DATELIB_SDT_ASM_1(990: nop)                                               \
+                         DATELIB_SDT_ASM_3(.pushsection .note.stapsdt, "?", "note")                \
+                         DATELIB_SDT_ASM_1(.balign 4)                                              \
+                         DATELIB_SDT_ASM_3(.4byte 992f-991f, 994f-993f, 3)                         \
+                         DATELIB_SDT_ASM_1(991: .asciz "stapsdt")                                  \
+                         DATELIB_SDT_ASM_1(992: .balign 4)                                         \
+                         DATELIB_SDT_ASM_1(993: .8byte 990b)                                       \
+                         DATELIB_SDT_ASM_1(.8byte 0)                                               \
+                         DATELIB_SDT_ASM_1(.8byte 0)                                               \
+                         DATELIB_SDT_ASM_STRING(datelib)                                           \
+                         DATELIB_SDT_ASM_STRING(name)                                              \
+                         DATELIB_SDT_ASM_STRING(DATELIB_SDT_FORMATS_##n)                           \
+                         DATELIB_SDT_ASM_1(994: .balign 4)                                         \
+                         DATELIB_SDT_ASM_1(.popsection)                                            \
+                         :                                                                         \
+                         : DATELIB_SDT_OPERANDS_##n(__VA_ARGS__))
+
+#define DATELIB_SDT_COUNT(...) DATELIB_SDT_COUNT_(__VA_ARGS__, 4, 3, 2, 1, 0)
+#define DATELIB_SDT_COUNT_(_1, _2, _3, _4, n, ...) n
+#define DATELIB_SDT_PROBE_N(name, n, ...) DATELIB_SDT_PROBE(name, n, __VA_ARGS__)
+
+#define DATELIB_PROBE(name, ...)                                                                   \
+    DATELIB_SDT_PROBE_N(name, DATELIB_SDT_COUNT(__VA_ARGS__), __VA_ARGS__)
+
+#else
+
+#define DATELIB_PROBE(name, ...) static_cast<void>(0)
+
+#endif
@@ -0,0 +1,118 @@
+#include "datelib/stats.h"
+
+#include <mutex>
+#include <vector>
+
+#include "stats_counters.h"
+
+namespace datelib {
+
+namespace {
+struct CounterInfo {
+    std::string_view name;
+    std::string_view help;
+};
+
+// In the order of the stats::Counter enumerators
+constexpr std::array<CounterInfo, stats::COUNTER_COUNT> COUNTERS = {{
+    {"datelib_is_holiday_calls_total", "HolidayCalendar::isHoliday() calls"},
+    {"datelib_rule_evaluations_total",
+     "Holiday rules evaluated for a year, to build the cache or name holidays"},
+    {"datelib_year_cache_hits_total", "Year lookups answered from an already built year"},
+    {"datelib_year_cache_misses_total", "Year lookups that had to build the year or wait for it"},
+    {"datelib_rule_exceptions_total", "Exceptions thrown out of a rule's evaluation"},
+    {"datelib_next_business_day_steps_total",
+     "Non-business days stepped over searching forward"},
+    {"datelib_previous_business_day_steps_total",
+     "Non-business days stepped over searching backward"},
+    {"datelib_add_business_days_steps_total",
+     "Calendar days walked while adding business days"},
+}};
+
+using Totals = std::array<std::uint64_t, stats::COUNTER_COUNT>;
+
+/**
+ * @brief The counters of live threads, and what exited threads counted
+ */
+struct Registry {
+    std::mutex mutex;
+    std::vector<const detail::ThreadCounters*> threads;
+    Totals exited{};
+    // Totals at the last reset(), subtracted from every snapshot
+    Totals reset_point{};
+
+    // Callers hold the mutex
+    Totals totals() const {
+        Totals sum = exited;
+        for (const auto* thread : threads) {
+            for (std::size_t i = 0; i < stats::COUNTER_COUNT; ++i) {
+                sum[i] += thread->values[i].load(std::memory_order_relaxed);
+            }
+        }
+        return sum;
+    }
+};
+
+// Never destroyed: threads may still exit, and unregister, during static destruction
+Registry& registry() {
+    static Registry* const instance = new Registry;
+    return *instance;
+}
+} // namespace
+
+namespace detail {
+
+ThreadCounters::ThreadCounters() {
+    Registry& counters = registry();
+    const std::scoped_lock lock(counters.mutex);
+    counters.threads.push_back(this);
+}
+
+ThreadCounters::~ThreadCounters() {
+    Registry& counters = registry();
+    const std::scoped_lock lock(counters.mutex);
+    for (std::size_t i = 0; i < stats::COUNTER_COUNT; ++i) {
+        counters.exited[i] += values[i].load(std::memory_order_relaxed);
+    }
+    std::erase(counters.threads, this);
+}
+
+} // namespace detail
+
+namespace stats {
+
+std::string_view metricName(const Counter counter) noexcept {
+    return COUNTERS[static_cast<std::size_t>(counter)].name;
+}
+
+std::string Snapshot::toPrometheus() const {
+    std::string text;
+    for (std::size_t i = 0; i < COUNTER_COUNT; ++i) {
+        const auto& [name, help] = COUNTERS[i];
+        text.append("# HELP ").append(name).append(" ").append(help).append("\n");
+        text.append("# TYPE ").append(name).append(" counter\n");
+        text.append(name).append(" ").append(std::to_string(values_[i])).append("\n");
+    }
+    return text;
+}
+
+Snapshot snapshot() {
+    Snapshot result;
+    Registry& counters = registry();
+    const std::scoped_lock lock(counters.mutex);
+    const Totals totals = counters.totals();
+    for (std::size_t i = 0; i < COUNTER_COUNT; ++i) {
+        result.values_[i] = totals[i] - counters.reset_point[i];
+    }
+    return result;
+}
+
+void reset() {
+    Registry& counters = registry();
+    const std::scoped_lock lock(counters.mutex);
+    counters.reset_point = counters.totals();
+}
+
+} // namespace stats
+
+} // namespace datelib
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "datelib/stats.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace datelib::detail {
+
+/**
+ * @brief The counters of one thread, alone on its cache line(s)
+ *
+ * Only the owning thread writes them, so an increment is a plain load and store; the atomics only
+ * make the reads of stats::snapshot() from other threads well defined.
+ */
+struct alignas(64) ThreadCounters {
+    ThreadCounters();
+    ~ThreadCounters();
+
+    ThreadCounters(const ThreadCounters&) = delete;
+    ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+    std::array<std::atomic<std::uint64_t>, stats::COUNTER_COUNT> values{};
+};
+
+/**
+ * @brief The counters of the calling thread, registered with the snapshot on first use
+ */
+inline ThreadCounters& threadCounters() {
+    thread_local ThreadCounters counters;
+    return counters;
+}
+
+/**
+ * @brief Count work on a hot path; compiles to nothing without DATELIB_ENABLE_STATS
+ */
+inline void countStat(const stats::Counter counter, const std::uint64_t amount = 1) {
+    if constexpr (stats::ENABLED) {
+        auto& value = threadCounters().values[static_cast<std::size_t>(counter)];
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+}
+
+} // namespace datelib::detail
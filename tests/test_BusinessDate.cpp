@@ -0,0 +1,112 @@
+#include "datelib/BusinessDate.h"
+#include "datelib/CompiledCalendar.h"
+#include "datelib/HolidayCalendar.h"
+#include "datelib/date.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::chrono;
+
+TEST_CASE("BusinessDate conversions", "[BusinessDate]") {
+    SECTION("Conversions are constexpr") {
+        constexpr datelib::BusinessDate date{2024y / March / 15};
+        STATIC_REQUIRE(date.year() == 2024);
+        STATIC_REQUIRE(date.month() == 3);
+        STATIC_REQUIRE(date.day() == 15);
+        STATIC_REQUIRE(date.weekday() == Friday);
+        STATIC_REQUIRE(date.dayOfYear() == 74);
+        STATIC_REQUIRE(datelib::BusinessDate{1970y / January / 1}.serial() == 0);
+        STATIC_REQUIRE(datelib::BusinessDate::serialOf(2000, 3, 1) == 11017);
+        STATIC_REQUIRE(datelib::BusinessDate::fromSerial(-1).civil() ==
+                       datelib::BusinessDate::Civil{1969, 12, 31});
+    }
+
+    SECTION("Serial numbers match sys_days") {
+        // Every day around 1900 (not a leap year), 2000 (a leap year) and 2100 (not a leap year)
+        for (sys_days d = sys_days{1896y / January / 1}; d <= sys_days{2104y / December / 31};
+             d += days{1}) {
+            const year_month_day ymd{d};
+            const datelib::BusinessDate date{ymd};
+            REQUIRE(date.serial() == d.time_since_epoch().count());
+            REQUIRE(date.toYearMonthDay() == ymd);
+            REQUIRE(date.weekday() == weekday{d});
+        }
+    }
+
+    SECTION("The whole range of std::chrono::year is supported") {
+        for (const year_month_day ymd :
+             {year::min() / January / 1, -1y / December / 31, 0y / February / 29,
+              year::max() / December / 31}) {
+            const datelib::BusinessDate date{ymd};
+            REQUIRE(date.serial() == sys_days{ymd}.time_since_epoch().count());
+            REQUIRE(date.toYearMonthDay() == ymd);
+            REQUIRE(date.weekday() == weekday{sys_days{ymd}});
+        }
+    }
+
+    SECTION("sys_days round trip") {
+        const sys_days d{2024y / July / 4};
+        REQUIRE(datelib::BusinessDate{d}.toSysDays() == d);
+        REQUIRE(datelib::BusinessDate{d} == datelib::BusinessDate{2024y / July / 4});
+    }
+}
+
+TEST_CASE("BusinessDate arithmetic", "[BusinessDate]") {
+    constexpr datelib::BusinessDate date{2024y / February / 28};
+
+    STATIC_REQUIRE((date + 1).day() == 29);
+    STATIC_REQUIRE((date + 2).month() == 3);
+    STATIC_REQUIRE((date - 28).toYearMonthDay() == 2024y / January / 31);
+    STATIC_REQUIRE(datelib::BusinessDate{2025y / February / 28} - date == 366);
+    STATIC_REQUIRE(date < date + 1);
+
+    datelib::BusinessDate current = date;
+    ++current;
+    REQUIRE(current.toYearMonthDay() == 2024y / February / 29);
+    --current;
+    --current;
+    REQUIRE(current.toYearMonthDay() == 2024y / February / 27);
+}
+
+TEST_CASE("Calendar functions on BusinessDate", "[BusinessDate][adjust][advance]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Memorial Day", 5, 1,
+                                                               datelib::Occurrence::Last));
+    const auto compiled = calendar.compile(2023, 2026);
+
+    SECTION("Matches the year_month_day functions") {
+        using enum datelib::BusinessDayConvention;
+        const auto three_months = datelib::Period::parse("3M");
+        const auto ten_days = datelib::Period::parse("-10D");
+        for (sys_days d = sys_days{2024y / January / 1}; d <= sys_days{2025y / December / 31};
+             d += days{1}) {
+            const year_month_day ymd{d};
+            const datelib::BusinessDate date{ymd};
+            REQUIRE(calendar.isHoliday(date) == calendar.isHoliday(ymd));
+            REQUIRE(datelib::isBusinessDay(date, calendar) ==
+                    datelib::isBusinessDay(ymd, calendar));
+            REQUIRE(compiled.isHoliday(date) == calendar.isHoliday(ymd));
+            REQUIRE(compiled.isBusinessDay(date) == datelib::isBusinessDay(ymd, calendar));
+            for (const auto convention :
+                 {Following, ModifiedFollowing, Preceding, ModifiedPreceding}) {
+                const year_month_day adjusted = datelib::adjust(ymd, convention, calendar);
+                REQUIRE(datelib::adjust(date, convention, calendar).toYearMonthDay() == adjusted);
+                REQUIRE(compiled.adjust(date, convention).toYearMonthDay() == adjusted);
+            }
+            REQUIRE(datelib::advance(date, three_months, ModifiedFollowing, calendar)
+                        .toYearMonthDay() ==
+                    datelib::advance(ymd, three_months, ModifiedFollowing, calendar));
+            REQUIRE(datelib::advance(date, ten_days, Following, calendar).toYearMonthDay() ==
+                    datelib::advance(ymd, ten_days, Following, calendar));
+        }
+    }
+
+    SECTION("Compiled lookups reject dates outside the range") {
+        REQUIRE_THROWS_AS(compiled.isBusinessDay(datelib::BusinessDate{2022y / December / 31}),
+                          datelib::DateOutOfRangeException);
+        REQUIRE_THROWS_AS(compiled.isHoliday(datelib::BusinessDate{2027y / January / 1}),
+                          datelib::DateOutOfRangeException);
+    }
+}
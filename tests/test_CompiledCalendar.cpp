@@ -0,0 +1,360 @@
+#include "datelib/HolidayCalendar.h"
+#include "datelib/date.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::chrono;
+
+namespace {
+datelib::HolidayCalendar makeUsCalendar() {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Independence Day", 7, 4));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Memorial Day", 5, 1,
+                                                               datelib::Occurrence::Last));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Thanksgiving", 11, 4,
+                                                               datelib::Occurrence::Fourth));
+    calendar.addHoliday("Day of Mourning", year_month_day{year{2025}, month{1}, day{9}});
+    return calendar;
+}
+} // namespace
+
+TEST_CASE("CompiledCalendar construction", "[CompiledCalendar]") {
+    const datelib::HolidayCalendar calendar = makeUsCalendar();
+
+    SECTION("Covers the requested years") {
+        const auto compiled = calendar.compile(2020, 2030);
+        REQUIRE(compiled.firstYear() == 2020);
+        REQUIRE(compiled.lastYear() == 2030);
+        REQUIRE(compiled.contains(year_month_day{year{2020}, month{1}, day{1}}));
+        REQUIRE(compiled.contains(year_month_day{year{2030}, month{12}, day{31}}));
+        REQUIRE_FALSE(compiled.contains(year_month_day{year{2019}, month{12}, day{31}}));
+        REQUIRE_FALSE(compiled.contains(year_month_day{year{2031}, month{1}, day{1}}));
+        REQUIRE_FALSE(compiled.contains(year_month_day{year{2024}, month{2}, day{30}}));
+    }
+
+    SECTION("Invalid ranges throw") {
+        REQUIRE_THROWS_AS(calendar.compile(2030, 2020), std::invalid_argument);
+        REQUIRE_THROWS_AS(calendar.compile(2020, 40000), std::invalid_argument);
+    }
+
+    SECTION("Snapshot is not affected by later changes") {
+        datelib::HolidayCalendar mutable_calendar = makeUsCalendar();
+        const auto compiled = mutable_calendar.compile(2024, 2024);
+        mutable_calendar.addHoliday("Extra", year_month_day{year{2024}, month{3}, day{5}});
+
+        REQUIRE(mutable_calendar.isHoliday(year_month_day{year{2024}, month{3}, day{5}}));
+        REQUIRE_FALSE(compiled.isHoliday(year_month_day{year{2024}, month{3}, day{5}}));
+    }
+
+    SECTION("Shared snapshot is reused until the calendar changes") {
+        datelib::HolidayCalendar mutable_calendar = makeUsCalendar();
+        const datelib::WeekendMask weekend;
+        const auto shared = mutable_calendar.compileShared(2020, 2030, weekend);
+        REQUIRE(shared->firstYear() == 2020);
+        REQUIRE(shared->lastYear() == 2030);
+        REQUIRE(mutable_calendar.compileShared(2024, 2025, weekend) == shared);
+
+        // A wider range or another weekend compiles again
+        REQUIRE(mutable_calendar.compileShared(2019, 2030, weekend) != shared);
+        const auto friday_saturday = datelib::WeekendMask::of(Friday, Saturday);
+        REQUIRE_FALSE(mutable_calendar.compileShared(2024, 2024, friday_saturday)->isBusinessDay(
+            year_month_day{year{2024}, month{3}, day{8}}));
+
+        const auto before = mutable_calendar.compileShared(2024, 2024, weekend);
+        mutable_calendar.addHoliday("Extra", year_month_day{year{2024}, month{3}, day{5}});
+        const auto after = mutable_calendar.compileShared(2024, 2024, weekend);
+        REQUIRE(after != before);
+        REQUIRE(after->isHoliday(year_month_day{year{2024}, month{3}, day{5}}));
+        REQUIRE_FALSE(before->isHoliday(year_month_day{year{2024}, month{3}, day{5}}));
+    }
+}
+
+TEST_CASE("CompiledCalendar queries", "[CompiledCalendar]") {
+    const datelib::HolidayCalendar calendar = makeUsCalendar();
+    const auto compiled = calendar.compile(2024, 2025);
+
+    SECTION("Holidays and business days") {
+        REQUIRE(compiled.isHoliday(year_month_day{year{2024}, month{12}, day{25}}));
+        REQUIRE(compiled.isHoliday(year_month_day{year{2025}, month{1}, day{9}}));
+        REQUIRE_FALSE(compiled.isHoliday(year_month_day{year{2024}, month{12}, day{24}}));
+
+        // Saturday is a weekend day but not a holiday
+        REQUIRE_FALSE(compiled.isHoliday(year_month_day{year{2024}, month{1}, day{6}}));
+        REQUIRE_FALSE(compiled.isBusinessDay(year_month_day{year{2024}, month{1}, day{6}}));
+        REQUIRE_FALSE(compiled.isBusinessDay(year_month_day{year{2024}, month{11}, day{28}}));
+        REQUIRE(compiled.isBusinessDay(year_month_day{year{2024}, month{11}, day{29}}));
+    }
+
+    SECTION("Out of range and invalid dates throw") {
+        REQUIRE_THROWS_AS(compiled.isHoliday(year_month_day{year{2026}, month{1}, day{1}}),
+                          datelib::DateOutOfRangeException);
+        REQUIRE_THROWS_AS(compiled.isBusinessDay(year_month_day{year{2023}, month{12}, day{31}}),
+                          datelib::DateOutOfRangeException);
+        REQUIRE_THROWS_AS(compiled.isBusinessDay(year_month_day{year{2024}, month{2}, day{30}}),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(compiled.advance(year_month_day{year{2024}, month{2}, day{30}},
+                                           datelib::Period(1, datelib::Period::Unit::Months),
+                                           datelib::BusinessDayConvention::Following),
+                          datelib::InvalidDateException);
+    }
+
+    SECTION("Custom weekend days") {
+        const std::unordered_set<weekday, datelib::WeekdayHash> friday_saturday = {Friday,
+                                                                                   Saturday};
+        const auto middle_east = calendar.compile(2024, 2024, friday_saturday);
+
+        REQUIRE_FALSE(middle_east.isBusinessDay(year_month_day{year{2024}, month{1}, day{5}}));
+        REQUIRE(middle_east.isBusinessDay(year_month_day{year{2024}, month{1}, day{7}}));
+    }
+
+    SECTION("Search does not leave the compiled range") {
+        // Saturday, December 31, 2022 and Saturday, January 1, 2022 are at the range boundaries
+        const auto single_year = calendar.compile(2022, 2022);
+        REQUIRE_THROWS_AS(single_year.adjust(year_month_day{year{2022}, month{12}, day{31}},
+                                             datelib::BusinessDayConvention::Following),
+                          datelib::BusinessDaySearchException);
+        REQUIRE_THROWS_AS(single_year.adjust(year_month_day{year{2022}, month{1}, day{1}},
+                                             datelib::BusinessDayConvention::Preceding),
+                          datelib::BusinessDaySearchException);
+        // Nearest only answers near a boundary when no day beyond it could be nearer: from
+        // Sunday, January 2 the Monday is closer than any day of 2021
+        REQUIRE(single_year.adjust(year_month_day{year{2022}, month{1}, day{2}},
+                                   datelib::BusinessDayConvention::Nearest) ==
+                year_month_day{year{2022}, month{1}, day{3}});
+        REQUIRE_THROWS_AS(single_year.adjust(year_month_day{year{2022}, month{1}, day{1}},
+                                             datelib::BusinessDayConvention::Nearest),
+                          datelib::BusinessDaySearchException);
+        REQUIRE_THROWS_AS(single_year.adjust(year_month_day{year{2022}, month{12}, day{31}},
+                                             datelib::BusinessDayConvention::Nearest),
+                          datelib::BusinessDaySearchException);
+        REQUIRE_THROWS_AS(single_year.advance(year_month_day{year{2022}, month{12}, day{30}},
+                                              datelib::Period(1, datelib::Period::Unit::Days),
+                                              datelib::BusinessDayConvention::Following),
+                          datelib::BusinessDaySearchException);
+    }
+}
+
+TEST_CASE("CompiledCalendar matches the rule-based functions", "[CompiledCalendar]") {
+    const datelib::HolidayCalendar calendar = makeUsCalendar();
+    const auto compiled = calendar.compile(2022, 2027);
+
+    using enum datelib::BusinessDayConvention;
+    const datelib::BusinessDayConvention conventions[] = {
+        Following, ModifiedFollowing, Preceding,  ModifiedPreceding,
+        Unadjusted, Nearest,           HalfMonthModifiedFollowing};
+    const datelib::Period periods[] = {
+        datelib::Period(1, datelib::Period::Unit::Days),
+        datelib::Period(-3, datelib::Period::Unit::Days),
+        datelib::Period(2, datelib::Period::Unit::Weeks),
+        datelib::Period(1, datelib::Period::Unit::Months),
+        datelib::Period(-13, datelib::Period::Unit::Months),
+        datelib::Period(1, datelib::Period::Unit::Years),
+    };
+
+    for (sys_days day_iter = sys_days{year{2024} / January / 1};
+         day_iter <= sys_days{year{2025} / December / 31}; day_iter += days{1}) {
+        const year_month_day date{day_iter};
+
+        REQUIRE(compiled.isHoliday(date) == calendar.isHoliday(date));
+        REQUIRE(compiled.isBusinessDay(date) == datelib::isBusinessDay(date, calendar));
+
+        for (const auto convention : conventions) {
+            REQUIRE(compiled.adjust(date, convention) ==
+                    datelib::adjust(date, convention, calendar));
+        }
+        for (const auto& period : periods) {
+            REQUIRE(compiled.advance(date, period, ModifiedFollowing) ==
+                    datelib::advance(date, period, ModifiedFollowing, calendar));
+        }
+    }
+}
+
+TEST_CASE("CompiledCalendar adjust beyond the distance table", "[CompiledCalendar]") {
+    using enum datelib::BusinessDayConvention;
+
+    // Three hundred holidays in a row are further than the distance table reaches
+    datelib::HolidayCalendar calendar;
+    for (sys_days day = sys_days{2024y / March / 1}; day < sys_days{2024y / March / 1} + days{300};
+         day += days{1}) {
+        calendar.addHoliday("Closed", year_month_day{day});
+    }
+    const auto compiled = calendar.compile(2023, 2025);
+
+    for (const auto convention : {Following, ModifiedFollowing, Preceding, ModifiedPreceding,
+                                  Nearest, HalfMonthModifiedFollowing}) {
+        for (sys_days day = sys_days{2024y / February / 20}; day <= sys_days{2025y / January / 10};
+             day += days{7}) {
+            const year_month_day date{day};
+            REQUIRE(compiled.adjust(date, convention) ==
+                    datelib::adjust(date, convention, calendar));
+        }
+    }
+}
+
+TEST_CASE("CompiledCalendar businessDaysBetween", "[CompiledCalendar]") {
+    const datelib::HolidayCalendar calendar = makeUsCalendar();
+    const auto compiled = calendar.compile(2020, 2030);
+
+    SECTION("Counts business days in (from, to]") {
+        // Friday, January 5, 2024 to Tuesday, January 9, 2024: Mon 8 and Tue 9
+        const year_month_day friday{year{2024}, month{1}, day{5}};
+        const year_month_day tuesday{year{2024}, month{1}, day{9}};
+        REQUIRE(compiled.businessDaysBetween(friday, tuesday) == 2);
+        REQUIRE(compiled.businessDaysBetween(tuesday, friday) == -2);
+        REQUIRE(compiled.businessDaysBetween(friday, friday) == 0);
+
+        // Saturday to Sunday contains no business day
+        REQUIRE(compiled.businessDaysBetween(year_month_day{year{2024}, month{1}, day{6}},
+                                             year_month_day{year{2024}, month{1}, day{7}}) == 0);
+    }
+
+    SECTION("Whole year skips weekends and holidays") {
+        // 2024 has 262 weekdays; five holidays fall on weekdays
+        REQUIRE(compiled.businessDaysBetween(year_month_day{year{2023}, month{12}, day{31}},
+                                             year_month_day{year{2024}, month{12}, day{31}}) ==
+                257);
+    }
+
+    SECTION("Agrees with advance over long periods") {
+        const year_month_day start{year{2024}, month{3}, day{15}};
+        for (const int n : {1, 2, 63, 64, 65, 250, 500, 1000, -1, -64, -500}) {
+            const datelib::Period period(n, datelib::Period::Unit::Days);
+            const auto end =
+                compiled.advance(start, period, datelib::BusinessDayConvention::Following);
+            REQUIRE(compiled.isBusinessDay(end));
+            REQUIRE(compiled.businessDaysBetween(start, end) == n);
+        }
+    }
+
+    SECTION("Invalid dates throw") {
+        const year_month_day in_range{year{2024}, month{3}, day{1}};
+        REQUIRE_THROWS_AS(
+            compiled.businessDaysBetween(year_month_day{year{2024}, month{2}, day{30}}, in_range),
+            std::invalid_argument);
+        REQUIRE_THROWS_AS(
+            compiled.businessDaysBetween(in_range, year_month_day{year{2031}, month{1}, day{1}}),
+            datelib::DateOutOfRangeException);
+    }
+}
+
+TEST_CASE("CompiledCalendar advance by business days matches advance", "[CompiledCalendar]") {
+    const datelib::HolidayCalendar calendar = makeUsCalendar();
+    const auto compiled = calendar.compile(2020, 2030);
+
+    for (const int n : {250, 500, -500}) {
+        const datelib::Period period(n, datelib::Period::Unit::Days);
+        for (sys_days day_iter = sys_days{year{2024} / December / 1};
+             day_iter <= sys_days{year{2025} / January / 31}; day_iter += days{1}) {
+            const year_month_day date{day_iter};
+            REQUIRE(compiled.advance(date, period, datelib::BusinessDayConvention::Following) ==
+                    datelib::advance(date, period, datelib::BusinessDayConvention::Following,
+                                     calendar));
+        }
+    }
+}
+
+TEST_CASE("CompiledCalendar batch queries", "[CompiledCalendar][batch]") {
+    const datelib::HolidayCalendar calendar = makeUsCalendar();
+    const auto compiled = calendar.compile(2020, 2030);
+
+    // Every day of 2024-2025 in a scrambled order, with a length that is not a multiple of 8
+    std::vector<sys_days> dates;
+    for (sys_days d = sys_days{year{2024} / January / 1}; d <= sys_days{year{2025} / December / 31};
+         d += days{1}) {
+        dates.push_back(d);
+    }
+    for (std::size_t i = 0; i < dates.size(); i += 7) {
+        std::swap(dates[i], dates[dates.size() - 1 - i / 7]);
+    }
+    dates.pop_back();
+
+    SECTION("isBusinessDay matches the scalar lookup") {
+        std::vector<std::uint8_t> out(dates.size());
+        compiled.isBusinessDay(dates, out);
+        for (std::size_t i = 0; i < dates.size(); ++i) {
+            REQUIRE((out[i] != 0) == compiled.isBusinessDay(year_month_day{dates[i]}));
+        }
+    }
+
+    SECTION("adjust matches the scalar adjust for every convention") {
+        using enum datelib::BusinessDayConvention;
+        for (const auto convention : {Following, ModifiedFollowing, Preceding, ModifiedPreceding,
+                                      Unadjusted, Nearest, HalfMonthModifiedFollowing}) {
+            std::vector<sys_days> out(dates.size());
+            compiled.adjust(dates, out, convention);
+            for (std::size_t i = 0; i < dates.size(); ++i) {
+                REQUIRE(year_month_day{out[i]} ==
+                        compiled.adjust(year_month_day{dates[i]}, convention));
+            }
+        }
+    }
+
+    SECTION("adjust can work in place") {
+        std::vector<sys_days> in_place = dates;
+        compiled.adjust(in_place, in_place, datelib::BusinessDayConvention::Following);
+        for (std::size_t i = 0; i < dates.size(); ++i) {
+            REQUIRE(year_month_day{in_place[i]} ==
+                    compiled.adjust(year_month_day{dates[i]},
+                                    datelib::BusinessDayConvention::Following));
+        }
+    }
+
+    SECTION("Out of range dates and size mismatches throw") {
+        std::vector<std::uint8_t> out(dates.size());
+        dates[dates.size() / 2] = sys_days{year{2031} / January / 1};
+        REQUIRE_THROWS_AS(compiled.isBusinessDay(dates, out), datelib::DateOutOfRangeException);
+        dates[dates.size() / 2] = sys_days{year{2019} / December / 31};
+        REQUIRE_THROWS_AS(compiled.isBusinessDay(dates, out), datelib::DateOutOfRangeException);
+
+        std::vector<sys_days> adjusted(dates.size());
+        REQUIRE_THROWS_AS(
+            compiled.adjust(dates, adjusted, datelib::BusinessDayConvention::Following),
+            datelib::DateOutOfRangeException);
+
+        std::vector<std::uint8_t> short_out(3);
+        REQUIRE_THROWS_AS(compiled.isBusinessDay(dates, short_out), std::invalid_argument);
+    }
+}
+
+TEST_CASE("CompiledCalendar tenor grid advance", "[CompiledCalendar][advance][batch]") {
+    const datelib::HolidayCalendar calendar = makeUsCalendar();
+    const auto compiled = calendar.compile(2020, 2060);
+
+    std::vector<datelib::Period> grid;
+    for (const auto* tenor : {"2D", "1W", "1M", "6M", "1Y", "10Y", "30Y", "-1M", "-5D"}) {
+        grid.push_back(datelib::Period::parse(tenor));
+    }
+    std::vector<year_month_day> pillars(grid.size());
+
+    SECTION("Matches the scalar advance") {
+        using enum datelib::BusinessDayConvention;
+        for (const auto& anchor :
+             {2024y / January / 31, 2024y / February / 29, 2025y / June / 30}) {
+            compiled.advance(anchor, grid, pillars, ModifiedFollowing);
+            for (std::size_t i = 0; i < grid.size(); ++i) {
+                REQUIRE(pillars[i] == compiled.advance(anchor, grid[i], ModifiedFollowing));
+            }
+        }
+    }
+
+    SECTION("Errors") {
+        std::vector<year_month_day> too_short(2);
+        REQUIRE_THROWS_AS(compiled.advance(2024y / January / 31, grid, too_short,
+                                           datelib::BusinessDayConvention::Following),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(compiled.advance(2024y / February / 30, grid, pillars,
+                                           datelib::BusinessDayConvention::Following),
+                          datelib::InvalidDateException);
+        // 50Y leaves the compiled range
+        const std::vector<datelib::Period> long_grid = {datelib::Period::parse("50Y")};
+        std::vector<year_month_day> one(1);
+        REQUIRE_THROWS_AS(compiled.advance(2024y / January / 31, long_grid, one,
+                                           datelib::BusinessDayConvention::Following),
+                          datelib::DateOutOfRangeException);
+    }
+}
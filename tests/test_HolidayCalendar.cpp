@@ -1,9 +1,46 @@
 #include "datelib/HolidayCalendar.h"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 
 using namespace std::chrono;
 
+namespace {
+// A user-defined rule: the first day of every quarter
+class QuarterStartRule : public datelib::HolidayRule {
+  public:
+    explicit QuarterStartRule(unsigned quarter) : quarter_(quarter) {}
+
+    [[nodiscard]] bool appliesTo(int /*year*/) const override { return true; }
+    [[nodiscard]] year_month_day calculateDate(int y) const override {
+        return year_month_day{year{y}, month{3 * quarter_ - 2}, day{1}};
+    }
+    [[nodiscard]] std::string getName() const override { return "Quarter start"; }
+    [[nodiscard]] std::unique_ptr<datelib::HolidayRule> clone() const override {
+        return std::make_unique<QuarterStartRule>(*this);
+    }
+
+  private:
+    unsigned quarter_;
+};
+
+// A subclass of a built-in rule that changes its behavior
+class ShiftedChristmasRule : public datelib::FixedDateRule {
+  public:
+    ShiftedChristmasRule() : FixedDateRule("Shifted Christmas", 12, 25) {}
+
+    [[nodiscard]] year_month_day calculateDate(int y) const override {
+        return year_month_day{year{y}, month{12}, day{26}};
+    }
+    [[nodiscard]] std::unique_ptr<datelib::HolidayRule> clone() const override {
+        return std::make_unique<ShiftedChristmasRule>(*this);
+    }
+};
+} // namespace
+
 TEST_CASE("HolidayCalendar construction", "[HolidayCalendar]") {
     REQUIRE_NOTHROW(datelib::HolidayCalendar());
 }
@@ -198,3 +235,354 @@ TEST_CASE("Real-world US holidays example", "[HolidayCalendar]") {
         REQUIRE(names[0] == "Thanksgiving");
     }
 }
+
+TEST_CASE("HolidayCalendar year cache", "[HolidayCalendar][cache]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+
+    // Materialize 2024 before changing the calendar
+    REQUIRE(calendar.isHoliday(year_month_day{year{2024}, month{12}, day{25}}));
+    REQUIRE_FALSE(calendar.isHoliday(year_month_day{year{2024}, month{7}, day{4}}));
+
+    SECTION("addHoliday invalidates cached years") {
+        calendar.addHoliday("July 4th 2024", year_month_day{year{2024}, month{7}, day{4}});
+        REQUIRE(calendar.isHoliday(year_month_day{year{2024}, month{7}, day{4}}));
+        REQUIRE(calendar.getHolidays(2024).size() == 2);
+    }
+
+    SECTION("addRule invalidates cached years") {
+        calendar.addRule(std::make_unique<datelib::FixedDateRule>("Independence Day", 7, 4));
+        REQUIRE(calendar.isHoliday(year_month_day{year{2024}, month{7}, day{4}}));
+        REQUIRE(calendar.getHolidayNames(year_month_day{year{2024}, month{7}, day{4}}).size() ==
+                1);
+    }
+
+    SECTION("Copies do not share cached years") {
+        datelib::HolidayCalendar copy(calendar);
+        copy.addRule(std::make_unique<datelib::FixedDateRule>("Independence Day", 7, 4));
+
+        REQUIRE(copy.isHoliday(year_month_day{year{2024}, month{7}, day{4}}));
+        REQUIRE_FALSE(calendar.isHoliday(year_month_day{year{2024}, month{7}, day{4}}));
+    }
+
+    SECTION("Copy assignment replaces cached years") {
+        datelib::HolidayCalendar other;
+        other.addRule(std::make_unique<datelib::FixedDateRule>("Independence Day", 7, 4));
+        calendar = other;
+
+        REQUIRE(calendar.isHoliday(year_month_day{year{2024}, month{7}, day{4}}));
+        REQUIRE_FALSE(calendar.isHoliday(year_month_day{year{2024}, month{12}, day{25}}));
+    }
+
+    SECTION("Moved calendars keep their holidays") {
+        datelib::HolidayCalendar moved(std::move(calendar));
+        REQUIRE(moved.isHoliday(year_month_day{year{2024}, month{12}, day{25}}));
+
+        datelib::HolidayCalendar assigned;
+        assigned = std::move(moved);
+        REQUIRE(assigned.isHoliday(year_month_day{year{2024}, month{12}, day{25}}));
+    }
+
+    SECTION("Leap day and last day of a leap year") {
+        calendar.addHoliday("Leap Day", year_month_day{year{2024}, month{2}, day{29}});
+        calendar.addHoliday("New Year's Eve", year_month_day{year{2024}, month{12}, day{31}});
+
+        REQUIRE(calendar.isHoliday(year_month_day{year{2024}, month{2}, day{29}}));
+        REQUIRE(calendar.isHoliday(year_month_day{year{2024}, month{12}, day{31}}));
+        REQUIRE_FALSE(calendar.isHoliday(year_month_day{year{2024}, month{3}, day{1}}));
+        REQUIRE(calendar.getHolidays(2024).back() ==
+                year_month_day{year{2024}, month{12}, day{31}});
+    }
+
+    SECTION("Invalid dates are never holidays") {
+        calendar.addHoliday("March 1st", year_month_day{year{2023}, month{3}, day{1}});
+        REQUIRE_FALSE(calendar.isHoliday(year_month_day{year{2023}, month{2}, day{29}}));
+    }
+
+    SECTION("Years at the ends of the supported range") {
+        calendar.addHoliday("First day", year_month_day{year::min(), month{1}, day{1}});
+        REQUIRE(calendar.isHoliday(year_month_day{year::min(), month{1}, day{1}}));
+        REQUIRE(calendar.isHoliday(year_month_day{year::max(), month{12}, day{25}}));
+        REQUIRE(calendar.getHolidays(static_cast<int>(year::max()) + 1).empty());
+    }
+}
+
+TEST_CASE("HolidayCalendar concurrent readers", "[HolidayCalendar][cache]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Thanksgiving", 11, 4,
+                                                               datelib::Occurrence::Fourth));
+    calendar.addHoliday("Jubilee", year_month_day{year{2022}, month{6}, day{3}});
+
+    // Reference answers from a separate calendar, so that the shared one starts cold
+    const datelib::HolidayCalendar reference(calendar);
+    const sys_days first{year{1990} / January / 1};
+    const sys_days last{year{2060} / December / 31};
+    std::vector<bool> expected;
+    for (sys_days day = first; day <= last; day += days{1}) {
+        expected.push_back(reference.isHoliday(year_month_day{day}));
+    }
+
+    // Every thread walks all the years from a different starting point, so that threads race
+    // to materialize the same years
+    constexpr int THREADS = 8;
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            const auto count = static_cast<std::ptrdiff_t>(expected.size());
+            for (std::ptrdiff_t i = 0; i < count; ++i) {
+                const std::ptrdiff_t index = (i + t * count / THREADS) % count;
+                if (calendar.isHoliday(year_month_day{first + days{index}}) !=
+                    expected[static_cast<std::size_t>(index)]) {
+                    mismatches.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(mismatches.load() == 0);
+}
+
+TEST_CASE("HolidayCalendar with custom rule types", "[HolidayCalendar]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<QuarterStartRule>(2));
+    calendar.addRule(std::make_unique<ShiftedChristmasRule>());
+
+    SECTION("Custom rules are evaluated") {
+        REQUIRE(calendar.isHoliday(year_month_day{year{2024}, month{4}, day{1}}));
+        auto names = calendar.getHolidayNames(year_month_day{year{2024}, month{4}, day{1}});
+        REQUIRE(names.size() == 1);
+        REQUIRE(names[0] == "Quarter start");
+    }
+
+    SECTION("Subclasses of built-in rules keep their overrides") {
+        REQUIRE(calendar.isHoliday(year_month_day{year{2024}, month{12}, day{26}}));
+        REQUIRE_FALSE(calendar.isHoliday(year_month_day{year{2024}, month{12}, day{25}}));
+    }
+
+    SECTION("Copies deep-copy custom rules") {
+        datelib::HolidayCalendar copy;
+        {
+            datelib::HolidayCalendar source(calendar);
+            copy = source;
+        }
+        REQUIRE(copy.isHoliday(year_month_day{year{2025}, month{4}, day{1}}));
+        REQUIRE(copy.isHoliday(year_month_day{year{2025}, month{12}, day{26}}));
+        REQUIRE(copy.getHolidays(2025).size() == 2);
+    }
+
+    SECTION("Null rules are rejected") {
+        REQUIRE_THROWS_AS(calendar.addRule(nullptr), std::invalid_argument);
+    }
+}
+
+TEST_CASE("HolidayCalendar with Easter-based rules", "[HolidayCalendar][easter]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::EasterRule>("Good Friday", -2));
+    calendar.addRule(std::make_unique<datelib::EasterRule>("Easter Monday", 1));
+    calendar.addRule(std::make_unique<datelib::OffsetFromRule>(
+        "Whit Monday", std::make_unique<datelib::EasterRule>("Easter Sunday"), 50));
+
+    SECTION("Holidays move with Easter every year") {
+        REQUIRE(calendar.getHolidays(2024) ==
+                std::vector<year_month_day>{2024y / March / 29, 2024y / April / 1,
+                                            2024y / May / 20});
+        REQUIRE(calendar.getHolidays(2025) ==
+                std::vector<year_month_day>{2025y / April / 18, 2025y / April / 21,
+                                            2025y / June / 9});
+        auto names = calendar.getHolidayNames(2025y / June / 9);
+        REQUIRE(names == std::vector<std::string>{"Whit Monday"});
+    }
+
+    SECTION("Copies and compiled snapshots keep the rules") {
+        const datelib::HolidayCalendar copy(calendar);
+        REQUIRE(copy.isHoliday(2026y / April / 3));
+        const auto compiled = copy.compile(2020, 2030);
+        for (int y = 2020; y <= 2030; ++y) {
+            for (const auto& holiday : calendar.getHolidays(y)) {
+                REQUIRE(compiled.isHoliday(holiday));
+            }
+        }
+    }
+
+    SECTION("Years outside the Easter table have no Easter holidays") {
+        REQUIRE(calendar.getHolidays(datelib::EASTER_LAST_YEAR + 1).empty());
+    }
+}
+
+TEST_CASE("HolidayCalendar with observed rules", "[HolidayCalendar][observed]") {
+    const auto observed = [](const std::string& name, const unsigned month, const unsigned day,
+                             const datelib::Observance observance) {
+        return std::make_unique<datelib::ObservedRule>(
+            name, std::make_unique<datelib::FixedDateRule>(name, month, day), observance);
+    };
+
+    SECTION("Substitutes chain over colliding holidays") {
+        datelib::HolidayCalendar uk;
+        uk.addRule(observed("Christmas Day", 12, 25, datelib::Observance::Substitute));
+        uk.addRule(observed("Boxing Day", 12, 26, datelib::Observance::Substitute));
+
+        // Saturday and Sunday: Monday and Tuesday
+        REQUIRE(uk.getHolidays(2021) ==
+                std::vector<year_month_day>{2021y / December / 27, 2021y / December / 28});
+        REQUIRE(uk.getHolidayNames(2021y / December / 28) ==
+                std::vector<std::string>{"Boxing Day"});
+
+        // Sunday and Monday: Boxing Day keeps Monday, Christmas moves to Tuesday
+        REQUIRE(uk.getHolidays(2022) ==
+                std::vector<year_month_day>{2022y / December / 26, 2022y / December / 27});
+        REQUIRE(uk.getHolidayNames(2022y / December / 27) ==
+                std::vector<std::string>{"Christmas Day"});
+    }
+
+    SECTION("Substitutes are placed in date order, whatever the order of the rules") {
+        datelib::HolidayCalendar uk;
+        uk.addRule(observed("Boxing Day", 12, 26, datelib::Observance::Substitute));
+        uk.addRule(observed("Christmas Day", 12, 25, datelib::Observance::Substitute));
+
+        // Saturday and Sunday: Christmas takes Monday even though its rule came second
+        REQUIRE(uk.getHolidayNames(2021y / December / 27) ==
+                std::vector<std::string>{"Christmas Day"});
+        REQUIRE(uk.getHolidayNames(2021y / December / 28) ==
+                std::vector<std::string>{"Boxing Day"});
+    }
+
+    SECTION("Substitutes for the same date follow the order of their rules") {
+        datelib::HolidayCalendar calendar;
+        calendar.addRule(observed("Second", 12, 25, datelib::Observance::Substitute));
+        calendar.addRule(observed("First", 12, 25, datelib::Observance::Substitute));
+        REQUIRE(calendar.getHolidayNames(2021y / December / 27) ==
+                std::vector<std::string>{"Second"});
+        REQUIRE(calendar.getHolidayNames(2021y / December / 28) ==
+                std::vector<std::string>{"First"});
+    }
+
+    SECTION("Substitutes skip explicit holidays") {
+        datelib::HolidayCalendar calendar;
+        calendar.addRule(observed("Christmas Day", 12, 25, datelib::Observance::Substitute));
+        calendar.addHoliday("Closure", 2021y / December / 27);
+        REQUIRE(calendar.getHolidays(2021) ==
+                std::vector<year_month_day>{2021y / December / 27, 2021y / December / 28});
+    }
+
+    SECTION("Observed dates in the neighbouring year belong to that year") {
+        datelib::HolidayCalendar us;
+        us.addRule(observed("New Year's Day", 1, 1, datelib::Observance::NearestWeekday));
+        REQUIRE(us.isHoliday(2021y / December / 31));
+        REQUIRE(us.getHolidayNames(2021y / December / 31) ==
+                std::vector<std::string>{"New Year's Day"});
+        REQUIRE_FALSE(us.isHoliday(2022y / January / 1));
+        REQUIRE(us.getHolidays(2022).empty());
+        REQUIRE(us.getHolidays(2021) ==
+                std::vector<year_month_day>{2021y / January / 1, 2021y / December / 31});
+    }
+
+    SECTION("Next Monday lets holidays share a day") {
+        datelib::HolidayCalendar calendar;
+        calendar.addRule(observed("Christmas Day", 12, 25, datelib::Observance::NextMonday));
+        calendar.addRule(observed("Boxing Day", 12, 26, datelib::Observance::NextMonday));
+        REQUIRE(calendar.getHolidays(2021) == std::vector<year_month_day>{2021y / December / 27});
+        REQUIRE(calendar.getHolidayNames(2021y / December / 27).size() == 2);
+    }
+
+    SECTION("Compiled snapshots match the calendar") {
+        datelib::HolidayCalendar uk;
+        uk.addRule(observed("New Year's Day", 1, 1, datelib::Observance::Substitute));
+        uk.addRule(observed("Christmas Day", 12, 25, datelib::Observance::Substitute));
+        uk.addRule(observed("Boxing Day", 12, 26, datelib::Observance::Substitute));
+        const auto compiled = uk.compile(2015, 2035);
+        for (auto date = sys_days{2015y / January / 1}; date <= sys_days{2035y / December / 31};
+             date += days{1}) {
+            REQUIRE(compiled.isHoliday(year_month_day{date}) ==
+                    uk.isHoliday(year_month_day{date}));
+        }
+    }
+}
+
+TEST_CASE("HolidayCalendar explicit date store", "[HolidayCalendar]") {
+    datelib::HolidayCalendar calendar;
+
+    SECTION("Out-of-order explicit dates are kept per year") {
+        calendar.addHoliday("Late", year_month_day{year{2025}, month{12}, day{31}});
+        calendar.addHoliday("Early", year_month_day{year{2024}, month{1}, day{1}});
+        calendar.addHoliday("Middle", year_month_day{year{2025}, month{1}, day{1}});
+
+        auto holidays2025 = calendar.getHolidays(2025);
+        REQUIRE(holidays2025.size() == 2);
+        REQUIRE(holidays2025[0] == year_month_day{year{2025}, month{1}, day{1}});
+        REQUIRE(holidays2025[1] == year_month_day{year{2025}, month{12}, day{31}});
+        REQUIRE(calendar.getHolidays(2024).size() == 1);
+        REQUIRE(calendar.getHolidays(2026).empty());
+    }
+
+    SECTION("Several names on the same date") {
+        calendar.addHoliday("First", year_month_day{year{2024}, month{5}, day{1}});
+        calendar.addHoliday("Second", year_month_day{year{2024}, month{5}, day{1}});
+
+        auto names = calendar.getHolidayNames(year_month_day{year{2024}, month{5}, day{1}});
+        REQUIRE(names == std::vector<std::string>{"First", "Second"});
+        REQUIRE(calendar.getHolidays(2024).size() == 1);
+    }
+
+    SECTION("ExplicitDateRule added as a rule joins the explicit store") {
+        calendar.addRule(std::make_unique<datelib::ExplicitDateRule>(
+            "Eclipse Day", year_month_day{year{2024}, month{4}, day{8}}));
+
+        REQUIRE(calendar.isHoliday(year_month_day{year{2024}, month{4}, day{8}}));
+        REQUIRE_FALSE(calendar.isHoliday(year_month_day{year{2025}, month{4}, day{8}}));
+        REQUIRE(calendar.getHolidayNames(year_month_day{year{2024}, month{4}, day{8}})[0] ==
+                "Eclipse Day");
+    }
+
+    SECTION("Invalid explicit dates throw") {
+        REQUIRE_THROWS_AS(calendar.addHoliday("Bad", year_month_day{year{2023}, month{2}, day{29}}),
+                          std::invalid_argument);
+    }
+}
+
+TEST_CASE("HolidayCalendar bulk explicit dates", "[HolidayCalendar]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addHoliday("Existing", year_month_day{year{2000}, month{6}, day{15}});
+
+    SECTION("Bulk load of many out-of-order dates") {
+        // Every third day from 1990 to 2019, loaded back to front
+        std::vector<std::pair<std::string, year_month_day>> holidays;
+        for (sys_days d = sys_days{year{2019} / December / 31}; d >= sys_days{year{1990} / 1 / 1};
+             d -= days{3}) {
+            holidays.emplace_back("Closure", year_month_day{d});
+        }
+        REQUIRE(holidays.size() > 3000);
+        calendar.addHolidays(holidays);
+
+        for (const auto& [name, date] : holidays) {
+            REQUIRE(calendar.isHoliday(date));
+        }
+        REQUIRE_FALSE(calendar.isHoliday(year_month_day{sys_days{year{2019} / December / 30}}));
+        REQUIRE(calendar.isHoliday(year_month_day{year{2000}, month{6}, day{15}}));
+
+        const auto names = calendar.getHolidayNames(year_month_day{year{2019}, month{12}, day{31}});
+        REQUIRE(names == std::vector<std::string>{"Closure"});
+    }
+
+    SECTION("An invalid date leaves the calendar unchanged") {
+        const std::vector<std::pair<std::string, year_month_day>> holidays = {
+            {"Good", year_month_day{year{2024}, month{3}, day{1}}},
+            {"Bad", year_month_day{year{2024}, month{2}, day{30}}},
+        };
+        REQUIRE_THROWS_AS(calendar.addHolidays(holidays), std::invalid_argument);
+        REQUIRE_FALSE(calendar.isHoliday(year_month_day{year{2024}, month{3}, day{1}}));
+    }
+
+    SECTION("Bulk loading invalidates cached years") {
+        REQUIRE_FALSE(calendar.isHoliday(year_month_day{year{2024}, month{3}, day{1}}));
+        const std::vector<std::pair<std::string, year_month_day>> holidays = {
+            {"Added", year_month_day{year{2024}, month{3}, day{1}}},
+        };
+        calendar.addHolidays(holidays);
+        REQUIRE(calendar.isHoliday(year_month_day{year{2024}, month{3}, day{1}}));
+    }
+}
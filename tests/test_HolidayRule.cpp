@@ -1,8 +1,11 @@
 #include "datelib/HolidayRule.h"
+#include "datelib/exceptions.h"
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
+#include <memory>
 #include <stdexcept>
+#include <vector>
 
 using namespace std::chrono;
 
@@ -142,6 +145,230 @@ TEST_CASE("NthWeekdayRule calculates correct dates", "[HolidayRule]") {
     }
 }
 
+TEST_CASE("NthWeekdayRule tryCalculateDate", "[HolidayRule][expected]") {
+    SECTION("Existing occurrence gives the same date as calculateDate") {
+        datelib::NthWeekdayRule laborDay("Labor Day", 9, 1, datelib::Occurrence::First);
+        REQUIRE(laborDay.tryCalculateDate(2024) == laborDay.calculateDate(2024));
+    }
+
+    SECTION("Missing occurrence is reported without throwing") {
+        datelib::NthWeekdayRule fifthSaturday("Fifth Saturday", 2, 6, datelib::Occurrence::Fifth);
+        const auto date = fifthSaturday.tryCalculateDate(2024);
+        REQUIRE_FALSE(date.has_value());
+        REQUIRE(date.error().code() == datelib::ErrorCode::OccurrenceNotFound);
+    }
+}
+
+TEST_CASE("EasterRule calculates correct dates", "[HolidayRule][easter]") {
+    SECTION("Easter Sunday") {
+        datelib::EasterRule easter("Easter Sunday");
+        REQUIRE(easter.calculateDate(2024) == year_month_day{year{2024}, month{3}, day{31}});
+        REQUIRE(easter.calculateDate(2025) == year_month_day{year{2025}, month{4}, day{20}});
+        REQUIRE(easter.calculateDate(2000) == year_month_day{year{2000}, month{4}, day{23}});
+        // Earliest and latest possible dates
+        REQUIRE(easter.calculateDate(2285) == year_month_day{year{2285}, month{3}, day{22}});
+        REQUIRE(easter.calculateDate(2038) == year_month_day{year{2038}, month{4}, day{25}});
+    }
+
+    SECTION("Offsets from Easter Sunday") {
+        datelib::EasterRule goodFriday("Good Friday", -2);
+        datelib::EasterRule whitMonday("Whit Monday", 50);
+        REQUIRE(goodFriday.calculateDate(2024) == year_month_day{year{2024}, month{3}, day{29}});
+        REQUIRE(whitMonday.calculateDate(2024) == year_month_day{year{2024}, month{5}, day{20}});
+
+        // Every Easter-based date is a Sunday plus its offset
+        for (int y = datelib::EASTER_FIRST_YEAR; y <= datelib::EASTER_LAST_YEAR; y += 37) {
+            REQUIRE(weekday{sys_days{goodFriday.calculateDate(y)}} == Friday);
+        }
+    }
+
+    SECTION("Years outside the table do not apply") {
+        datelib::EasterRule easter("Easter Sunday");
+        REQUIRE(easter.appliesTo(datelib::EASTER_FIRST_YEAR));
+        REQUIRE(easter.appliesTo(datelib::EASTER_LAST_YEAR));
+        REQUIRE_FALSE(easter.appliesTo(datelib::EASTER_FIRST_YEAR - 1));
+        REQUIRE_FALSE(easter.appliesTo(datelib::EASTER_LAST_YEAR + 1));
+        REQUIRE_THROWS_AS(easter.calculateDate(1500), datelib::DateNotInYearException);
+    }
+
+    SECTION("Offsets leaving the year do not apply") {
+        datelib::EasterRule farAway("Far away", 300);
+        REQUIRE_FALSE(farAway.appliesTo(2024));
+        REQUIRE_THROWS_AS(farAway.calculateDate(2024), datelib::DateNotInYearException);
+    }
+}
+
+TEST_CASE("OffsetFromRule calculates correct dates", "[HolidayRule]") {
+    SECTION("Offset from an Nth weekday rule") {
+        datelib::OffsetFromRule blackFriday(
+            "Black Friday",
+            std::make_unique<datelib::NthWeekdayRule>("Thanksgiving", 11, 4,
+                                                      datelib::Occurrence::Fourth),
+            1);
+        REQUIRE(blackFriday.calculateDate(2024) == year_month_day{year{2024}, month{11}, day{29}});
+    }
+
+    SECTION("Offset from an Easter rule") {
+        datelib::OffsetFromRule ascension(
+            "Ascension Day", std::make_unique<datelib::EasterRule>("Easter Sunday"), 39);
+        REQUIRE(ascension.calculateDate(2024) == year_month_day{year{2024}, month{5}, day{9}});
+    }
+
+    SECTION("Follows the base rule's years") {
+        datelib::OffsetFromRule dayAfter(
+            "Day after",
+            std::make_unique<datelib::NthWeekdayRule>("Fifth Saturday", 2, 6,
+                                                      datelib::Occurrence::Fifth),
+            1);
+        REQUIRE_FALSE(dayAfter.appliesTo(2024));
+        REQUIRE_THROWS_AS(dayAfter.calculateDate(2024), datelib::DateNotInYearException);
+
+        datelib::OffsetFromRule newYear(
+            "Day after New Year's Eve", std::make_unique<datelib::FixedDateRule>("NYE", 12, 31),
+            1);
+        REQUIRE_FALSE(newYear.appliesTo(2024));
+    }
+
+    SECTION("Null base rule is rejected") {
+        REQUIRE_THROWS_AS(datelib::OffsetFromRule("Nothing", nullptr, 1), std::invalid_argument);
+    }
+
+    SECTION("Copies and clones own their base rule") {
+        datelib::OffsetFromRule original(
+            "Easter Monday", std::make_unique<datelib::EasterRule>("Easter Sunday"), 1);
+        const datelib::OffsetFromRule copy(original);
+        auto cloned = original.clone();
+        original = datelib::OffsetFromRule(
+            "Good Friday", std::make_unique<datelib::EasterRule>("Easter Sunday"), -2);
+
+        REQUIRE(copy.calculateDate(2024) == year_month_day{year{2024}, month{4}, day{1}});
+        REQUIRE(cloned->calculateDate(2024) == year_month_day{year{2024}, month{4}, day{1}});
+        REQUIRE(cloned->getName() == "Easter Monday");
+        REQUIRE(original.calculateDate(2024) == year_month_day{year{2024}, month{3}, day{29}});
+    }
+}
+
+TEST_CASE("ObservedRule calculates observed dates", "[HolidayRule][observed]") {
+    const auto observed = [](const unsigned month, const unsigned day,
+                             const datelib::Observance observance) {
+        return datelib::ObservedRule(
+            "Observed", std::make_unique<datelib::FixedDateRule>("Actual", month, day),
+            observance);
+    };
+
+    SECTION("Nearest weekday") {
+        const auto july4 = observed(7, 4, datelib::Observance::NearestWeekday);
+        // Saturday to Friday, Sunday to Monday, weekdays unchanged
+        REQUIRE(july4.calculateDate(2026) == 2026y / July / 3);
+        REQUIRE(july4.calculateDate(2021) == 2021y / July / 5);
+        REQUIRE(july4.calculateDate(2024) == 2024y / July / 4);
+    }
+
+    SECTION("Next Monday") {
+        const auto christmas = observed(12, 25, datelib::Observance::NextMonday);
+        REQUIRE(christmas.calculateDate(2021) == 2021y / December / 27);
+        REQUIRE(christmas.calculateDate(2022) == 2022y / December / 26);
+    }
+
+    SECTION("Observed dates may leave the year") {
+        const auto newYear = observed(1, 1, datelib::Observance::NearestWeekday);
+        REQUIRE(newYear.calculateDate(2022) == 2021y / December / 31);
+    }
+
+    SECTION("Custom weekend") {
+        const datelib::ObservedRule holiday(
+            "Observed", std::make_unique<datelib::FixedDateRule>("Actual", 3, 1),
+            datelib::Observance::NextMonday,
+            datelib::WeekendMask::of(std::chrono::Friday, std::chrono::Saturday));
+        // 2024-03-01 is a Friday, observed on Sunday
+        REQUIRE(holiday.calculateDate(2024) == 2024y / March / 3);
+    }
+
+    SECTION("Actual date, copies and null rules") {
+        const auto christmas = observed(12, 25, datelib::Observance::Substitute);
+        REQUIRE(christmas.actualDate(2021) == 2021y / December / 25);
+        const auto copy = christmas;
+        REQUIRE(copy.clone()->calculateDate(2021) == 2021y / December / 27);
+        REQUIRE_THROWS_AS(datelib::ObservedRule("Nothing", nullptr,
+                                                datelib::Observance::NearestWeekday),
+                          std::invalid_argument);
+    }
+}
+
+TEST_CASE("HolidayRule tryDate evaluates a rule once", "[HolidayRule][tryDate]") {
+    SECTION("Agrees with appliesTo and calculateDate") {
+        auto easter = std::make_unique<datelib::EasterRule>("Easter Sunday");
+        std::vector<std::unique_ptr<datelib::HolidayRule>> rules;
+        rules.push_back(std::make_unique<datelib::FixedDateRule>("Leap Day", 2, 29));
+        rules.push_back(std::make_unique<datelib::NthWeekdayRule>("Fifth Friday", 3, 5,
+                                                                  datelib::Occurrence::Fifth));
+        rules.push_back(std::make_unique<datelib::EasterRule>("Easter Monday", 1));
+        rules.push_back(
+            std::make_unique<datelib::OffsetFromRule>("Ascension", std::move(easter), 39));
+        rules.push_back(std::make_unique<datelib::ObservedRule>(
+            "Christmas (observed)", std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25),
+            datelib::Observance::NearestWeekday));
+        rules.push_back(std::make_unique<datelib::ExplicitDateRule>(
+            "Jubilee", year_month_day{year{2022}, month{6}, day{3}}));
+
+        for (const auto& rule : rules) {
+            for (int y = 2018; y <= 2030; ++y) {
+                const auto date = rule->tryDate(y);
+                REQUIRE(date.has_value() == rule->appliesTo(y));
+                if (date) {
+                    REQUIRE(*date == rule->calculateDate(y));
+                }
+            }
+        }
+    }
+
+    SECTION("Years a rule does not occur in give nullopt") {
+        REQUIRE_FALSE(datelib::FixedDateRule("Leap Day", 2, 29).tryDate(2023).has_value());
+        REQUIRE(datelib::FixedDateRule("Leap Day", 2, 29).tryDate(2024) ==
+                year_month_day{year{2024}, month{2}, day{29}});
+        const datelib::ExplicitDateRule jubilee("Jubilee",
+                                                year_month_day{year{2022}, month{6}, day{3}});
+        REQUIRE_FALSE(jubilee.tryDate(2023).has_value());
+        REQUIRE_FALSE(datelib::EasterRule("Easter Sunday").tryDate(1500).has_value());
+        // March 2025 has no fifth Friday
+        REQUIRE_FALSE(
+            datelib::NthWeekdayRule("Fifth Friday", 3, 5, datelib::Occurrence::Fifth)
+                .tryDate(2025)
+                .has_value());
+    }
+
+    SECTION("Custom rules work through the default implementation") {
+        class EvenYearRule : public datelib::HolidayRule {
+          public:
+            [[nodiscard]] bool appliesTo(int y) const override { return y % 2 == 0; }
+            [[nodiscard]] year_month_day calculateDate(int y) const override {
+                return year_month_day{year{y}, month{7}, day{1}};
+            }
+            [[nodiscard]] std::string getName() const override { return "Even year"; }
+            [[nodiscard]] std::unique_ptr<datelib::HolidayRule> clone() const override {
+                return std::make_unique<EvenYearRule>(*this);
+            }
+        };
+
+        const EvenYearRule rule;
+        REQUIRE(rule.tryDate(2024) == year_month_day{year{2024}, month{7}, day{1}});
+        REQUIRE_FALSE(rule.tryDate(2025).has_value());
+    }
+
+    SECTION("Subclasses of built-in rules keep their calculateDate override") {
+        class BoxingDayRule : public datelib::FixedDateRule {
+          public:
+            BoxingDayRule() : FixedDateRule("Boxing Day", 12, 25) {}
+            [[nodiscard]] year_month_day calculateDate(int y) const override {
+                return year_month_day{year{y}, month{12}, day{26}};
+            }
+        };
+
+        const BoxingDayRule rule;
+        REQUIRE(rule.tryDate(2024) == year_month_day{year{2024}, month{12}, day{26}});
+    }
+}
+
 TEST_CASE("HolidayRule clone", "[HolidayRule]") {
     SECTION("ExplicitDateRule clone") {
         year_month_day ymd{year{2024}, month{10}, day{31}};
@@ -0,0 +1,188 @@
+#include "datelib/HolidayCalendar.h"
+#include "datelib/JointCalendar.h"
+#include "datelib/date.h"
+
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::chrono;
+
+namespace {
+datelib::HolidayCalendar makeNewYork() {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Memorial Day", 5, 1,
+                                                               datelib::Occurrence::Last));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Independence Day", 7, 4));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Thanksgiving", 11, 4,
+                                                               datelib::Occurrence::Fourth));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    return calendar;
+}
+
+datelib::HolidayCalendar makeLondon() {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::EasterRule>("Good Friday", -2));
+    calendar.addRule(std::make_unique<datelib::EasterRule>("Easter Monday", 1));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Spring Bank Holiday", 5, 1,
+                                                               datelib::Occurrence::Last));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Boxing Day", 12, 26));
+    return calendar;
+}
+} // namespace
+
+TEST_CASE("JointCalendar construction", "[JointCalendar]") {
+    const datelib::HolidayCalendar new_york = makeNewYork();
+    const datelib::HolidayCalendar london = makeLondon();
+
+    SECTION("Calendars and join rule") {
+        const datelib::JointCalendar joint({new_york, london},
+                                           datelib::JoinRule::JoinBusinessDays);
+        REQUIRE(joint.size() == 2);
+        REQUIRE(joint.joinRule() == datelib::JoinRule::JoinBusinessDays);
+        REQUIRE(datelib::JointCalendar({new_york}).joinRule() ==
+                datelib::JoinRule::JoinHolidays);
+    }
+
+    SECTION("At least one calendar is required") {
+        REQUIRE_THROWS_AS(datelib::JointCalendar({}), std::invalid_argument);
+    }
+}
+
+TEST_CASE("JointCalendar holidays", "[JointCalendar]") {
+    const datelib::HolidayCalendar new_york = makeNewYork();
+    const datelib::HolidayCalendar london = makeLondon();
+    const datelib::JointCalendar either({new_york, london});
+    const datelib::JointCalendar both({new_york, london}, datelib::JoinRule::JoinBusinessDays);
+
+    SECTION("Joining holidays takes the holidays of any calendar") {
+        REQUIRE(either.isHoliday(2024y / July / 4));
+        REQUIRE(either.isHoliday(2024y / December / 26));
+        REQUIRE(either.isHoliday(2024y / May / 27));
+        REQUIRE_FALSE(either.isHoliday(2024y / July / 5));
+    }
+
+    SECTION("Joining business days keeps only the common holidays") {
+        REQUIRE_FALSE(both.isHoliday(2024y / July / 4));
+        REQUIRE_FALSE(both.isHoliday(2024y / December / 26));
+        REQUIRE(both.isHoliday(2024y / December / 25));
+        // Memorial Day and the Spring Bank Holiday are both the last Monday of May
+        REQUIRE(both.isHoliday(2024y / May / 27));
+    }
+
+    SECTION("Every day matches the calendars it joins") {
+        for (sys_days day = sys_days{2023y / December / 1}; day <= sys_days{2026y / January / 31};
+             day += days{1}) {
+            const year_month_day date{day};
+            REQUIRE(either.isHoliday(date) == (new_york.isHoliday(date) || london.isHoliday(date)));
+            REQUIRE(both.isHoliday(date) == (new_york.isHoliday(date) && london.isHoliday(date)));
+            REQUIRE(either.isBusinessDay(date) == (datelib::isBusinessDay(date, new_york) &&
+                                                   datelib::isBusinessDay(date, london)));
+            REQUIRE(both.isBusinessDay(date) == (datelib::isBusinessDay(date, new_york) ||
+                                                 datelib::isBusinessDay(date, london)));
+        }
+    }
+
+    SECTION("Holidays of a year") {
+        const auto holidays = both.getHolidays(2024);
+        REQUIRE(holidays == std::vector<year_month_day>{2024y / January / 1, 2024y / May / 27,
+                                                        2024y / December / 25});
+        REQUIRE(either.getHolidays(2024).size() == 8);
+    }
+
+    SECTION("Invalid dates") {
+        REQUIRE_FALSE(either.isHoliday(2024y / February / 30));
+        REQUIRE_THROWS_AS(either.isBusinessDay(2024y / February / 30), std::invalid_argument);
+    }
+
+    SECTION("Changes to a calendar are seen by the joint calendar") {
+        datelib::HolidayCalendar tokyo;
+        const datelib::JointCalendar joint({new_york, tokyo});
+        REQUIRE_FALSE(joint.isHoliday(2024y / May / 3));
+        tokyo.addHoliday("Constitution Memorial Day", 2024y / May / 3);
+        REQUIRE(joint.isHoliday(2024y / May / 3));
+    }
+}
+
+TEST_CASE("JointCalendar adjust and advance", "[JointCalendar]") {
+    using enum datelib::BusinessDayConvention;
+
+    // A merged calendar holding the rules of both gives the reference results for JoinHolidays
+    const datelib::HolidayCalendar new_york = makeNewYork();
+    const datelib::HolidayCalendar london = makeLondon();
+    datelib::HolidayCalendar merged = makeNewYork();
+    merged.addRule(std::make_unique<datelib::EasterRule>("Good Friday", -2));
+    merged.addRule(std::make_unique<datelib::EasterRule>("Easter Monday", 1));
+    merged.addRule(std::make_unique<datelib::FixedDateRule>("Boxing Day", 12, 26));
+    const datelib::JointCalendar joint({new_york, london});
+
+    SECTION("Christmas and Boxing Day roll together") {
+        REQUIRE(joint.adjust(2020y / December / 25, Following) == 2020y / December / 28);
+        REQUIRE(joint.adjust(2021y / December / 24, Following) == 2021y / December / 24);
+        REQUIRE(joint.adjust(2021y / December / 25, Following) == 2021y / December / 27);
+        REQUIRE(joint.adjust(2024y / December / 25, Following) == 2024y / December / 27);
+        REQUIRE(joint.adjust(2024y / December / 25, Preceding) == 2024y / December / 24);
+    }
+
+    SECTION("Every convention matches the merged calendar") {
+        for (const auto convention : {Following, ModifiedFollowing, Preceding, ModifiedPreceding,
+                                      Unadjusted, Nearest, HalfMonthModifiedFollowing}) {
+            for (sys_days day = sys_days{2023y / December / 1};
+                 day <= sys_days{2025y / January / 31}; day += days{1}) {
+                const year_month_day date{day};
+                REQUIRE(joint.adjust(date, convention) ==
+                        datelib::adjust(date, convention, merged));
+            }
+        }
+    }
+
+    SECTION("Advance matches the merged calendar") {
+        const year_month_day start = 2024y / March / 28;
+        for (const auto* tenor : {"1D", "2D", "5D", "-1D", "-3D", "30D", "300D", "-300D", "1W",
+                                  "1M", "6M", "1Y", "10Y"}) {
+            const auto period = datelib::Period::parse(tenor);
+            REQUIRE(joint.advance(start, period, ModifiedFollowing) ==
+                    datelib::advance(start, period, ModifiedFollowing, merged));
+        }
+    }
+
+    SECTION("A custom weekend is honoured") {
+        const auto friday_saturday = datelib::WeekendMask::of(Friday, Saturday);
+        for (sys_days day = sys_days{2024y / January / 1}; day <= sys_days{2024y / March / 31};
+             day += days{1}) {
+            const year_month_day date{day};
+            REQUIRE(joint.adjust(date, Following, friday_saturday) ==
+                    datelib::adjust(date, Following, merged, friday_saturday));
+        }
+    }
+
+    SECTION("Joining business days only rolls over common holidays") {
+        const datelib::JointCalendar both({new_york, london},
+                                          datelib::JoinRule::JoinBusinessDays);
+        // Boxing Day is a New York business day, Independence Day a London one
+        REQUIRE(both.adjust(2024y / December / 26, Following) == 2024y / December / 26);
+        REQUIRE(both.adjust(2024y / July / 4, Following) == 2024y / July / 4);
+        REQUIRE(both.adjust(2024y / December / 25, Following) == 2024y / December / 26);
+    }
+
+    SECTION("Errors") {
+        REQUIRE_THROWS_AS(joint.adjust(2024y / February / 30, Following), std::invalid_argument);
+        REQUIRE_THROWS_AS(joint.advance(2024y / February / 30, datelib::Period::parse("1M"),
+                                        Following),
+                          datelib::InvalidDateException);
+
+        // A calendar without any business day cannot be searched
+        const auto every_day = datelib::WeekendMask::of(Monday, Tuesday, Wednesday, Thursday,
+                                                         Friday, Saturday, Sunday);
+        REQUIRE_THROWS_AS(joint.adjust(2024y / June / 3, Following, every_day),
+                          datelib::BusinessDaySearchException);
+        REQUIRE_THROWS_AS(joint.adjust(2024y / June / 3, Preceding, every_day),
+                          datelib::BusinessDaySearchException);
+        REQUIRE_THROWS_AS(
+            joint.advance(2024y / June / 3, datelib::Period::parse("1D"), Following, every_day),
+            datelib::BusinessDaySearchException);
+    }
+}
@@ -0,0 +1,227 @@
+#include "datelib/HolidayCalendar.h"
+#include "datelib/Schedule.h"
+
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::chrono;
+
+namespace {
+std::vector<year_month_day> unadjustedDates(const datelib::Schedule& schedule) {
+    std::vector<year_month_day> dates(schedule.size());
+    REQUIRE(schedule.generate(dates) == schedule.size());
+    return dates;
+}
+
+datelib::Period monthly(const int value) {
+    return datelib::Period{value, datelib::Period::Unit::Months};
+}
+} // namespace
+
+TEST_CASE("Schedule construction", "[Schedule]") {
+    using enum datelib::BusinessDayConvention;
+
+    SECTION("Invalid dates are rejected") {
+        REQUIRE_THROWS_AS(datelib::Schedule(2024y / February / 30, 2025y / January / 15,
+                                            monthly(3), Following),
+                          datelib::InvalidDateException);
+        REQUIRE_THROWS_AS(datelib::Schedule(2024y / January / 15, 2025y / February / 30,
+                                            monthly(3), Following),
+                          datelib::InvalidDateException);
+    }
+
+    SECTION("Termination must be after the effective date") {
+        REQUIRE_THROWS_AS(
+            datelib::Schedule(2024y / January / 15, 2024y / January / 15, monthly(3), Following),
+            std::invalid_argument);
+        REQUIRE_THROWS_AS(
+            datelib::Schedule(2025y / January / 15, 2024y / January / 15, monthly(3), Following),
+            std::invalid_argument);
+    }
+
+    SECTION("Tenor must be a positive calendar period") {
+        REQUIRE_THROWS_AS(datelib::Schedule(2024y / January / 15, 2025y / January / 15,
+                                            datelib::Period::parse("5D"), Following),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+            datelib::Schedule(2024y / January / 15, 2025y / January / 15, monthly(0), Following),
+            std::invalid_argument);
+        REQUIRE_THROWS_AS(
+            datelib::Schedule(2024y / January / 15, 2025y / January / 15, monthly(-3), Following),
+            std::invalid_argument);
+    }
+}
+
+TEST_CASE("Schedule regular periods", "[Schedule]") {
+    using enum datelib::BusinessDayConvention;
+
+    SECTION("Whole number of tenors has no stub in either direction") {
+        for (const auto generation :
+             {datelib::DateGeneration::Forward, datelib::DateGeneration::Backward}) {
+            const datelib::Schedule schedule(2024y / March / 15, 2026y / March / 15, monthly(6),
+                                             Unadjusted, generation);
+            REQUIRE_FALSE(schedule.hasStub());
+            REQUIRE(unadjustedDates(schedule) ==
+                    std::vector<year_month_day>{2024y / March / 15, 2024y / September / 15,
+                                                2025y / March / 15, 2025y / September / 15,
+                                                2026y / March / 15});
+        }
+    }
+
+    SECTION("Weekly tenor") {
+        const datelib::Schedule schedule(2024y / January / 1, 2024y / January / 29,
+                                         datelib::Period::parse("2W"), Unadjusted);
+        REQUIRE(unadjustedDates(schedule) ==
+                std::vector<year_month_day>{2024y / January / 1, 2024y / January / 15,
+                                            2024y / January / 29});
+    }
+
+    SECTION("Yearly tenor") {
+        const datelib::Schedule schedule(2024y / June / 30, 2027y / June / 30,
+                                         datelib::Period::parse("1Y"), Unadjusted);
+        REQUIRE(schedule.size() == 4);
+        REQUIRE(unadjustedDates(schedule).back() == 2027y / June / 30);
+    }
+
+    SECTION("Clamped month ends do not drift") {
+        // Rolling from the 31st: Feb 29 must not turn later dates into the 29th
+        const datelib::Schedule schedule(2024y / January / 31, 2024y / May / 31, monthly(1),
+                                         Unadjusted, datelib::DateGeneration::Forward);
+        REQUIRE(unadjustedDates(schedule) ==
+                std::vector<year_month_day>{2024y / January / 31, 2024y / February / 29,
+                                            2024y / March / 31, 2024y / April / 30,
+                                            2024y / May / 31});
+    }
+}
+
+TEST_CASE("Schedule stubs", "[Schedule]") {
+    using enum datelib::BusinessDayConvention;
+    using datelib::DateGeneration;
+    using datelib::StubType;
+
+    const year_month_day effective = 2024y / January / 10;
+    const year_month_day termination = 2025y / March / 15;
+
+    SECTION("Short front stub") {
+        const datelib::Schedule schedule(effective, termination, monthly(6), Unadjusted,
+                                         DateGeneration::Backward, StubType::Short);
+        REQUIRE(schedule.hasStub());
+        REQUIRE(unadjustedDates(schedule) ==
+                std::vector<year_month_day>{effective, 2024y / March / 15,
+                                            2024y / September / 15, termination});
+    }
+
+    SECTION("Long front stub") {
+        const datelib::Schedule schedule(effective, termination, monthly(6), Unadjusted,
+                                         DateGeneration::Backward, StubType::Long);
+        REQUIRE(schedule.hasStub());
+        REQUIRE(unadjustedDates(schedule) ==
+                std::vector<year_month_day>{effective, 2024y / September / 15, termination});
+    }
+
+    SECTION("Short back stub") {
+        const datelib::Schedule schedule(effective, termination, monthly(6), Unadjusted,
+                                         DateGeneration::Forward, StubType::Short);
+        REQUIRE(unadjustedDates(schedule) ==
+                std::vector<year_month_day>{effective, 2024y / July / 10, 2025y / January / 10,
+                                            termination});
+    }
+
+    SECTION("Long back stub") {
+        const datelib::Schedule schedule(effective, termination, monthly(6), Unadjusted,
+                                         DateGeneration::Forward, StubType::Long);
+        REQUIRE(unadjustedDates(schedule) ==
+                std::vector<year_month_day>{effective, 2024y / July / 10, termination});
+    }
+
+    SECTION("A range shorter than the tenor is a single stub period") {
+        for (const auto stub : {StubType::Short, StubType::Long}) {
+            const datelib::Schedule schedule(2024y / January / 10, 2024y / March / 1, monthly(6),
+                                             Unadjusted, DateGeneration::Backward, stub);
+            REQUIRE(schedule.hasStub());
+            REQUIRE(unadjustedDates(schedule) ==
+                    std::vector<year_month_day>{2024y / January / 10, 2024y / March / 1});
+        }
+    }
+}
+
+TEST_CASE("Schedule end-of-month roll", "[Schedule]") {
+    using enum datelib::BusinessDayConvention;
+
+    SECTION("Month-end anchor rolls on month ends") {
+        const datelib::Schedule schedule(2024y / February / 29, 2024y / June / 30, monthly(1),
+                                         Unadjusted, datelib::DateGeneration::Forward,
+                                         datelib::StubType::Short, true);
+        REQUIRE(unadjustedDates(schedule) ==
+                std::vector<year_month_day>{2024y / February / 29, 2024y / March / 31,
+                                            2024y / April / 30, 2024y / May / 31,
+                                            2024y / June / 30});
+    }
+
+    SECTION("Without the roll the day of month is kept") {
+        const datelib::Schedule schedule(2024y / February / 29, 2024y / May / 29, monthly(1),
+                                         Unadjusted, datelib::DateGeneration::Forward);
+        REQUIRE(unadjustedDates(schedule) ==
+                std::vector<year_month_day>{2024y / February / 29, 2024y / March / 29,
+                                            2024y / April / 29, 2024y / May / 29});
+    }
+
+    SECTION("Backward generation from a month end") {
+        const datelib::Schedule schedule(2023y / December / 31, 2024y / June / 30, monthly(3),
+                                         Unadjusted, datelib::DateGeneration::Backward,
+                                         datelib::StubType::Short, true);
+        REQUIRE_FALSE(schedule.hasStub());
+        REQUIRE(unadjustedDates(schedule) ==
+                std::vector<year_month_day>{2023y / December / 31, 2024y / March / 31,
+                                            2024y / June / 30});
+    }
+
+    SECTION("A non month-end anchor ignores the roll") {
+        const datelib::Schedule schedule(2024y / January / 30, 2024y / March / 30, monthly(1),
+                                         Unadjusted, datelib::DateGeneration::Forward,
+                                         datelib::StubType::Short, true);
+        REQUIRE(unadjustedDates(schedule) ==
+                std::vector<year_month_day>{2024y / January / 30, 2024y / February / 29,
+                                            2024y / March / 30});
+    }
+}
+
+TEST_CASE("Schedule adjusted dates", "[Schedule]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+
+    const datelib::Schedule schedule(2023y / December / 25, 2026y / March / 1, monthly(3),
+                                     datelib::BusinessDayConvention::ModifiedFollowing);
+    std::vector<year_month_day> unadjusted(schedule.size());
+    std::vector<year_month_day> adjusted(schedule.size());
+
+    SECTION("Every date is adjusted with the schedule's convention") {
+        REQUIRE(schedule.generate(unadjusted, adjusted, calendar) == schedule.size());
+        for (std::size_t i = 0; i < schedule.size(); ++i) {
+            REQUIRE(adjusted[i] ==
+                    datelib::adjust(unadjusted[i],
+                                    datelib::BusinessDayConvention::ModifiedFollowing, calendar));
+        }
+        // Christmas 2023 rolls to Tuesday the 26th
+        REQUIRE(adjusted.front() == 2023y / December / 26);
+    }
+
+    SECTION("A compiled calendar gives the same dates") {
+        const auto compiled = calendar.compile(2023, 2026);
+        std::vector<year_month_day> compiled_unadjusted(schedule.size());
+        std::vector<year_month_day> compiled_adjusted(schedule.size());
+        schedule.generate(unadjusted, adjusted, calendar);
+        schedule.generate(compiled_unadjusted, compiled_adjusted, compiled);
+        REQUIRE(compiled_unadjusted == unadjusted);
+        REQUIRE(compiled_adjusted == adjusted);
+    }
+
+    SECTION("Output spans that are too small are rejected") {
+        std::vector<year_month_day> too_small(schedule.size() - 1);
+        REQUIRE_THROWS_AS(schedule.generate(too_small), std::invalid_argument);
+        REQUIRE_THROWS_AS(schedule.generate(unadjusted, too_small, calendar),
+                          std::invalid_argument);
+    }
+}
@@ -0,0 +1,50 @@
+#include "datelib/TenorCache.h"
+
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("TenorCache resolves like Period::parse", "[TenorCache]") {
+    datelib::TenorCache tenors;
+
+    SECTION("Repeated strings are interned once") {
+        for (int pass = 0; pass < 3; ++pass) {
+            for (const auto* text : {"1M", "3M", "6M", "1Y", "10Y", "-2W", "+5D", "1m"}) {
+                const auto period = tenors.resolve(text);
+                const auto parsed = datelib::Period::parse(text);
+                REQUIRE(period.value() == parsed.value());
+                REQUIRE(period.unit() == parsed.unit());
+            }
+        }
+        REQUIRE(tenors.size() == 8);
+    }
+
+    SECTION("Strings that only differ in length are distinct") {
+        REQUIRE(tenors.resolve("1M").value() == 1);
+        REQUIRE(tenors.resolve("10M").value() == 10);
+        REQUIRE(tenors.resolve("100M").value() == 100);
+        REQUIRE(tenors.size() == 3);
+    }
+
+    SECTION("Long strings are parsed without being interned") {
+        REQUIRE(tenors.resolve("12345678D").value() == 12345678);
+        REQUIRE(tenors.size() == 0);
+    }
+
+    SECTION("Invalid strings are reported and never interned") {
+        REQUIRE(tenors.tryResolve("5X").error().code() == datelib::ErrorCode::InvalidPeriodUnit);
+        REQUIRE(tenors.tryResolve("").error().code() == datelib::ErrorCode::EmptyPeriod);
+        REQUIRE_THROWS_WITH(tenors.resolve("5X"),
+                            "Invalid period unit 'X'. Must be D, W, M, or Y: 5X");
+        REQUIRE(tenors.size() == 0);
+    }
+
+    SECTION("A full table keeps resolving by parsing") {
+        for (std::size_t i = 0; i < datelib::TenorCache::MAX_ENTRIES + 10; ++i) {
+            const std::string text = std::to_string(i) + "D";
+            REQUIRE(tenors.resolve(text).value() == static_cast<int>(i));
+        }
+        REQUIRE(tenors.size() == datelib::TenorCache::MAX_ENTRIES);
+        REQUIRE(tenors.resolve("57D").value() == 57);
+    }
+}
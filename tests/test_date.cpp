@@ -2,6 +2,10 @@
 #include "datelib/date.h"
 #include "datelib/period.h"
 
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
@@ -432,6 +436,84 @@ TEST_CASE("adjust with ModifiedPreceding convention", "[adjust]") {
     }
 }
 
+TEST_CASE("adjust with Nearest convention", "[adjust]") {
+    datelib::HolidayCalendar calendar;
+
+    SECTION("Business day remains unchanged") {
+        auto date = year_month_day{year{2024}, month{1}, day{2}};
+        auto adjusted = datelib::adjust(date, datelib::BusinessDayConvention::Nearest, calendar);
+        REQUIRE(adjusted == date);
+    }
+
+    SECTION("Saturday moves back to Friday") {
+        // Saturday, January 6, 2024 -> Friday, January 5, 2024
+        auto date = year_month_day{year{2024}, month{1}, day{6}};
+        auto adjusted = datelib::adjust(date, datelib::BusinessDayConvention::Nearest, calendar);
+        REQUIRE(adjusted == year_month_day{year{2024}, month{1}, day{5}});
+    }
+
+    SECTION("Sunday moves forward to Monday") {
+        // Sunday, January 7, 2024 -> Monday, January 8, 2024
+        auto date = year_month_day{year{2024}, month{1}, day{7}};
+        auto adjusted = datelib::adjust(date, datelib::BusinessDayConvention::Nearest, calendar);
+        REQUIRE(adjusted == year_month_day{year{2024}, month{1}, day{8}});
+    }
+
+    SECTION("Tie moves forward") {
+        // Wednesday, January 10, 2024 is a holiday, Tuesday and Thursday are one day away
+        calendar.addHoliday("Closed", year_month_day{year{2024}, month{1}, day{10}});
+        auto date = year_month_day{year{2024}, month{1}, day{10}};
+        auto adjusted = datelib::adjust(date, datelib::BusinessDayConvention::Nearest, calendar);
+        REQUIRE(adjusted == year_month_day{year{2024}, month{1}, day{11}});
+    }
+
+    SECTION("Crosses month boundaries") {
+        // Saturday, August 31, 2024 -> Friday, August 30, 2024
+        // Sunday, September 1, 2024 -> Monday, September 2, 2024
+        auto adjusted = datelib::adjust(year_month_day{year{2024}, month{8}, day{31}},
+                                        datelib::BusinessDayConvention::Nearest, calendar);
+        REQUIRE(adjusted == year_month_day{year{2024}, month{8}, day{30}});
+        adjusted = datelib::adjust(year_month_day{year{2024}, month{6}, day{30}},
+                                   datelib::BusinessDayConvention::Nearest, calendar);
+        REQUIRE(adjusted == year_month_day{year{2024}, month{7}, day{1}});
+    }
+}
+
+TEST_CASE("adjust with HalfMonthModifiedFollowing convention", "[adjust]") {
+    datelib::HolidayCalendar calendar;
+    const auto convention = datelib::BusinessDayConvention::HalfMonthModifiedFollowing;
+
+    SECTION("Business day remains unchanged") {
+        auto date = year_month_day{year{2024}, month{1}, day{2}};
+        REQUIRE(datelib::adjust(date, convention, calendar) == date);
+    }
+
+    SECTION("Weekend within a half month moves forward") {
+        // Saturday, June 8, 2024 -> Monday, June 10, 2024
+        auto adjusted =
+            datelib::adjust(year_month_day{year{2024}, month{6}, day{8}}, convention, calendar);
+        REQUIRE(adjusted == year_month_day{year{2024}, month{6}, day{10}});
+        // Sunday, June 16, 2024 -> Monday, June 17, 2024
+        adjusted =
+            datelib::adjust(year_month_day{year{2024}, month{6}, day{16}}, convention, calendar);
+        REQUIRE(adjusted == year_month_day{year{2024}, month{6}, day{17}});
+    }
+
+    SECTION("Weekend on the 15th does not cross into the second half") {
+        // Saturday, June 15, 2024: Following gives Monday, June 17, so this moves back to the 14th
+        auto adjusted =
+            datelib::adjust(year_month_day{year{2024}, month{6}, day{15}}, convention, calendar);
+        REQUIRE(adjusted == year_month_day{year{2024}, month{6}, day{14}});
+    }
+
+    SECTION("Weekend at month end does not cross into the next month") {
+        // Saturday, August 31, 2024 -> Friday, August 30, 2024
+        auto adjusted =
+            datelib::adjust(year_month_day{year{2024}, month{8}, day{31}}, convention, calendar);
+        REQUIRE(adjusted == year_month_day{year{2024}, month{8}, day{30}});
+    }
+}
+
 TEST_CASE("adjust with Unadjusted convention", "[adjust]") {
     datelib::HolidayCalendar calendar;
 
@@ -691,6 +773,111 @@ TEST_CASE("Period::parse with invalid strings", "[period][edge_cases]") {
     }
 }
 
+TEST_CASE("Period::tryParse", "[period][expected]") {
+    using datelib::ErrorCode;
+
+    SECTION("Valid strings give the same period as parse") {
+        for (const auto* text : {"5D", "2W", "6M", "10Y", "-3M", "+1Y", "0D"}) {
+            const auto period = datelib::Period::tryParse(text);
+            REQUIRE(period.has_value());
+            const auto parsed = datelib::Period::parse(text);
+            REQUIRE(period->value() == parsed.value());
+            REQUIRE(period->unit() == parsed.unit());
+        }
+    }
+
+    SECTION("Invalid strings give an error code") {
+        REQUIRE(datelib::Period::tryParse("").error().code() == ErrorCode::EmptyPeriod);
+        REQUIRE(datelib::Period::tryParse("D").error().code() == ErrorCode::MissingPeriodValue);
+        REQUIRE(datelib::Period::tryParse("10").error().code() == ErrorCode::InvalidPeriodFormat);
+        REQUIRE(datelib::Period::tryParse("5DW").error().code() ==
+                ErrorCode::InvalidPeriodFormat);
+        REQUIRE(datelib::Period::tryParse("5.5D").error().code() ==
+                ErrorCode::InvalidPeriodFormat);
+        REQUIRE(datelib::Period::tryParse("5X").error().code() == ErrorCode::InvalidPeriodUnit);
+        REQUIRE(datelib::Period::tryParse("999999999999999999999D").error().code() ==
+                ErrorCode::InvalidPeriodValue);
+    }
+
+    SECTION("Errors carry a static message") {
+        const auto error = datelib::Period::tryParse("").error();
+        REQUIRE(error.message() == "Period string cannot be empty");
+    }
+}
+
+TEST_CASE("Period::parse with compound and money market tenors", "[period]") {
+    using datelib::Period;
+
+    SECTION("Years and months combine into months") {
+        REQUIRE(Period::parse("1Y6M") == Period(18, Period::Unit::Months));
+        REQUIRE(Period::parse("2y3m") == Period(27, Period::Unit::Months));
+        REQUIRE(Period::parse("-1Y6M") == Period(-18, Period::Unit::Months));
+        REQUIRE(Period::parse("10Y0M") == Period(120, Period::Unit::Months));
+    }
+
+    SECTION("Money market tenors are business days from the trade date") {
+        REQUIRE(Period::parse("ON") == Period(1, Period::Unit::Days));
+        REQUIRE(Period::parse("TN") == Period(2, Period::Unit::Days));
+        REQUIRE(Period::parse("SN") == Period(3, Period::Unit::Days));
+        REQUIRE(Period::parse("on") == Period(1, Period::Unit::Days));
+    }
+
+    SECTION("Other combinations are rejected") {
+        REQUIRE_THROWS_WITH(Period::parse("6M1Y"),
+                            "Compound period must be years followed by months: 6M1Y");
+        REQUIRE_THROWS_WITH(Period::parse("1W2D"),
+                            "Compound period must be years followed by months: 1W2D");
+        REQUIRE_THROWS_WITH(Period::parse("1M2W"),
+                            "Compound period must be years followed by months: 1M2W");
+        REQUIRE(Period::tryParse("1Y2W").error().code() ==
+                datelib::ErrorCode::InvalidCompoundPeriod);
+        REQUIRE_THROWS_WITH(Period::parse("1Y6M2D"),
+                            "Compound period must be years followed by months: 1Y6M2D");
+        REQUIRE_THROWS_WITH(Period::parse("1Y6"),
+                            "Period string must end with a single unit character (D/W/M/Y): 1Y6");
+        REQUIRE_THROWS_WITH(Period::parse("1Y6X"),
+                            "Invalid period unit 'X'. Must be D, W, M, or Y: 1Y6X");
+        REQUIRE(Period::tryParse("XN").error().code() == datelib::ErrorCode::MissingPeriodValue);
+        REQUIRE(Period::tryParse("-").error().code() == datelib::ErrorCode::MissingPeriodValue);
+    }
+
+    SECTION("Values must fit in an int") {
+        REQUIRE(Period::parse("2147483647D").value() == 2147483647);
+        REQUIRE(Period::parse("-2147483648D").value() == -2147483647 - 1);
+        REQUIRE(Period::tryParse("2147483648D").error().code() ==
+                datelib::ErrorCode::InvalidPeriodValue);
+        REQUIRE(Period::tryParse("178956971Y0M").error().code() ==
+                datelib::ErrorCode::InvalidPeriodValue);
+    }
+
+    SECTION("Compound tenors advance like their months") {
+        datelib::HolidayCalendar calendar;
+        const auto date = year_month_day{year{2024}, month{1}, day{31}};
+        REQUIRE(datelib::advance(date, "1Y6M", datelib::BusinessDayConvention::Following,
+                                 calendar) ==
+                datelib::advance(date, "18M", datelib::BusinessDayConvention::Following,
+                                 calendar));
+    }
+}
+
+TEST_CASE("Period literals and constexpr parsing", "[period]") {
+    using namespace datelib::literals;
+    using datelib::Period;
+
+    static_assert(3_M == Period(3, Period::Unit::Months));
+    static_assert(2_D == Period(2, Period::Unit::Days));
+    static_assert(1_W == Period(1, Period::Unit::Weeks));
+    static_assert(10_Y == Period(10, Period::Unit::Years));
+    static_assert("1Y6M"_tenor == 18_M);
+    static_assert("SN"_tenor == 3_D);
+    // Money market tenors are plain day offsets once parsed
+    static_assert("TN"_tenor == 2_D);
+    static_assert(Period::tryParse("5X").error().code() == datelib::ErrorCode::InvalidPeriodUnit);
+
+    constexpr Period tenor = "6M"_tenor;
+    REQUIRE(tenor == Period::parse("6M"));
+}
+
 TEST_CASE("Period construction and use with advance", "[period][advance]") {
     datelib::HolidayCalendar calendar;
 
@@ -728,6 +915,14 @@ TEST_CASE("advance with days period", "[advance]") {
         REQUIRE(result == year_month_day{year{2024}, month{1}, day{3}});
     }
 
+    SECTION("Advance by more than a year of business days") {
+        // 500 business days from Monday, January 1, 2024 without holidays: 100 whole weeks
+        auto date = year_month_day{year{2024}, month{1}, day{1}};
+        auto result =
+            datelib::advance(date, "500D", datelib::BusinessDayConvention::Following, calendar);
+        REQUIRE(result == year_month_day{year{2025}, month{12}, day{1}});
+    }
+
     SECTION("Advance by 0 business days") {
         // Tuesday, January 2, 2024 + 0 business days = Tuesday, January 2, 2024
         auto date = year_month_day{year{2024}, month{1}, day{2}};
@@ -915,6 +1110,63 @@ TEST_CASE("advance with negative periods", "[advance]") {
     }
 }
 
+TEST_CASE("advance by business days matches a day by day walk", "[advance][edge_cases]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Thanksgiving", 11, 4,
+                                                               datelib::Occurrence::Fourth));
+
+    // Reference: step one calendar day at a time, counting the business days passed
+    auto walk = [&](const year_month_day start, const int count,
+                    const datelib::WeekendMask weekend) {
+        sys_days current{start};
+        for (int remaining = std::abs(count); remaining > 0;) {
+            current += days{count > 0 ? 1 : -1};
+            if (datelib::isBusinessDay(year_month_day{current}, calendar, weekend)) {
+                --remaining;
+            }
+        }
+        return year_month_day{current};
+    };
+
+    const auto friday_saturday = datelib::WeekendMask::of(Friday, Saturday);
+    for (const auto weekend : {datelib::WeekendMask{}, friday_saturday}) {
+        for (const int start_day : {0, 3, 58, 59, 200, 333, 360, 365}) {
+            const auto start = year_month_day{sys_days{year{2023} / January / 1} + days{start_day}};
+            for (const int count : {1, 5, 22, 63, 64, 65, 130, 261, 500, 1000}) {
+                for (const int signed_count : {count, -count}) {
+                    const auto period = datelib::Period(signed_count, datelib::Period::Unit::Days);
+                    REQUIRE(datelib::advance(start, period,
+                                             datelib::BusinessDayConvention::Unadjusted, calendar,
+                                             weekend) == walk(start, signed_count, weekend));
+                }
+            }
+        }
+    }
+
+    SECTION("More than a year without business days stops the walk") {
+        // Closed from Wednesday, January 1, 2025 to Friday, January 2, 2026
+        datelib::HolidayCalendar closed;
+        for (sys_days d = year{2025} / January / 1; d <= sys_days{year{2026} / January / 2};
+             d += days{1}) {
+            closed.addHoliday("Closed", year_month_day{d});
+        }
+        // Friday, December 27, 2024 reaches Tuesday, December 31, 2024 but no further
+        const auto start = year_month_day{year{2024}, month{12}, day{27}};
+        REQUIRE(datelib::advance(start, "2D", datelib::BusinessDayConvention::Unadjusted,
+                                 closed) == year_month_day{year{2024}, month{12}, day{31}});
+        REQUIRE_THROWS_AS(datelib::advance(start, "3D", datelib::BusinessDayConvention::Unadjusted,
+                                           closed),
+                          datelib::BusinessDaySearchException);
+        // Coming back from Monday, January 5, 2026 stops likewise
+        const auto after = year_month_day{year{2026}, month{1}, day{5}};
+        REQUIRE_THROWS_AS(datelib::advance(after, "-1D",
+                                           datelib::BusinessDayConvention::Unadjusted, closed),
+                          datelib::BusinessDaySearchException);
+    }
+}
+
 TEST_CASE("advance with invalid input", "[advance][edge_cases]") {
     datelib::HolidayCalendar calendar;
 
@@ -1009,3 +1261,305 @@ TEST_CASE("advance real-world scenarios", "[advance]") {
         REQUIRE(maturity == year_month_day{year{2034}, month{1}, day{2}});
     }
 }
+
+TEST_CASE("WeekendMask", "[WeekendMask]") {
+    SECTION("Default mask has no weekend days") {
+        constexpr datelib::WeekendMask none;
+        STATIC_REQUIRE(none.bits() == 0);
+        REQUIRE_FALSE(none.contains(Saturday));
+        REQUIRE_FALSE(none.contains(Sunday));
+    }
+
+    SECTION("Saturday and Sunday") {
+        constexpr auto weekend = datelib::WeekendMask::saturdaySunday();
+        STATIC_REQUIRE(weekend.contains(Saturday));
+        STATIC_REQUIRE(weekend.contains(Sunday));
+        STATIC_REQUIRE_FALSE(weekend.contains(Monday));
+        STATIC_REQUIRE_FALSE(weekend.contains(Friday));
+    }
+
+    SECTION("Built from weekdays") {
+        constexpr auto weekend = datelib::WeekendMask::of(Friday, Saturday);
+        STATIC_REQUIRE(weekend.contains(Friday));
+        STATIC_REQUIRE(weekend.contains(Saturday));
+        STATIC_REQUIRE_FALSE(weekend.contains(Sunday));
+        STATIC_REQUIRE(weekend == datelib::WeekendMask{}.add(Saturday).add(Friday));
+    }
+
+    SECTION("Weekday 7 is Sunday and invalid weekdays are ignored") {
+        auto weekend = datelib::WeekendMask::of(weekday{7}, weekday{9});
+        REQUIRE(weekend.contains(Sunday));
+        REQUIRE_FALSE(weekend.contains(weekday{9}));
+        REQUIRE(weekend.bits() == 1);
+    }
+
+    SECTION("Built from a set of weekdays") {
+        const std::unordered_set<weekday, datelib::WeekdayHash> days = {Thursday, Friday};
+        const datelib::WeekendMask weekend{days};
+        REQUIRE(weekend == datelib::WeekendMask::of(Thursday, Friday));
+    }
+}
+
+TEST_CASE("Business day functions with WeekendMask", "[WeekendMask][configurable]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    constexpr auto friday_saturday = datelib::WeekendMask::of(Friday, Saturday);
+
+    SECTION("isBusinessDay") {
+        // Friday, January 5, 2024 and Sunday, January 7, 2024
+        REQUIRE_FALSE(datelib::isBusinessDay(year_month_day{year{2024}, month{1}, day{5}},
+                                             calendar, friday_saturday));
+        REQUIRE(datelib::isBusinessDay(year_month_day{year{2024}, month{1}, day{7}}, calendar,
+                                       friday_saturday));
+        REQUIRE(datelib::isBusinessDay(year_month_day{year{2024}, month{1}, day{6}}, calendar,
+                                       datelib::WeekendMask{}));
+    }
+
+    SECTION("adjust") {
+        // Friday, January 5, 2024 moves to Sunday, January 7, 2024
+        REQUIRE(datelib::adjust(year_month_day{year{2024}, month{1}, day{5}},
+                                datelib::BusinessDayConvention::Following, calendar,
+                                friday_saturday) == year_month_day{year{2024}, month{1}, day{7}});
+    }
+
+    SECTION("advance") {
+        // Thursday, January 4, 2024 + 1 business day skips Friday and Saturday
+        REQUIRE(datelib::advance(year_month_day{year{2024}, month{1}, day{4}}, "1D",
+                                 datelib::BusinessDayConvention::Following, calendar,
+                                 friday_saturday) == year_month_day{year{2024}, month{1}, day{7}});
+        REQUIRE(datelib::advance(year_month_day{year{2024}, month{1}, day{4}},
+                                 datelib::Period(1, datelib::Period::Unit::Weeks),
+                                 datelib::BusinessDayConvention::Following, calendar,
+                                 friday_saturday) == year_month_day{year{2024}, month{1}, day{11}});
+    }
+
+    SECTION("compile") {
+        const auto compiled = calendar.compile(2024, 2024, friday_saturday);
+        REQUIRE_FALSE(compiled.isBusinessDay(year_month_day{year{2024}, month{1}, day{5}}));
+        REQUIRE(compiled.isBusinessDay(year_month_day{year{2024}, month{1}, day{7}}));
+    }
+}
+
+TEST_CASE("Batch isBusinessDay and adjust", "[isBusinessDay][adjust][batch]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Memorial Day", 5, 1,
+                                                               datelib::Occurrence::Last));
+
+    // A column of dates spread over several years
+    std::vector<sys_days> dates;
+    const sys_days first = sys_days{year{2019} / December / 20};
+    const sys_days last = sys_days{year{2023} / January / 10};
+    for (sys_days d = first; d <= last; d += days{5}) {
+        dates.push_back(d);
+    }
+
+    SECTION("isBusinessDay matches the scalar function") {
+        std::vector<std::uint8_t> out(dates.size());
+        datelib::isBusinessDay(dates, out, calendar);
+        for (std::size_t i = 0; i < dates.size(); ++i) {
+            REQUIRE((out[i] != 0) == datelib::isBusinessDay(year_month_day{dates[i]}, calendar));
+        }
+    }
+
+    SECTION("adjust matches the scalar function") {
+        constexpr auto weekend = datelib::WeekendMask::of(Friday, Saturday);
+        using enum datelib::BusinessDayConvention;
+        for (const auto convention : {Following, ModifiedFollowing, Preceding, ModifiedPreceding}) {
+            std::vector<sys_days> out(dates.size());
+            datelib::adjust(dates, out, convention, calendar, weekend);
+            for (std::size_t i = 0; i < dates.size(); ++i) {
+                REQUIRE(year_month_day{out[i]} ==
+                        datelib::adjust(year_month_day{dates[i]}, convention, calendar, weekend));
+            }
+        }
+    }
+
+    SECTION("Far-off sentinel dates are looked up without compiling the years in between") {
+        std::vector<sys_days> column = dates;
+        column.push_back(sys_days{year{9999} / December / 31});
+        column.push_back(sys_days{year{1} / January / 1});
+        column.push_back(sys_days{year{2021} / December / 25});
+
+        std::vector<std::uint8_t> flags(column.size());
+        datelib::isBusinessDay(column, flags, calendar);
+        std::vector<sys_days> adjusted(column.size());
+        datelib::adjust(column, adjusted, datelib::BusinessDayConvention::ModifiedFollowing,
+                        calendar);
+        for (std::size_t i = 0; i < column.size(); ++i) {
+            REQUIRE((flags[i] != 0) == datelib::isBusinessDay(year_month_day{column[i]}, calendar));
+            REQUIRE(year_month_day{adjusted[i]} ==
+                    datelib::adjust(year_month_day{column[i]},
+                                    datelib::BusinessDayConvention::ModifiedFollowing, calendar));
+        }
+        // Friday, December 31, 9999 is a business day; Saturday, December 25, 2021 moves on
+        REQUIRE(flags[dates.size()] == 1);
+        REQUIRE(adjusted[dates.size() + 2] == sys_days{year{2021} / December / 27});
+    }
+
+    SECTION("Empty batches and size mismatches") {
+        std::vector<std::uint8_t> flags;
+        std::vector<sys_days> adjusted;
+        REQUIRE_NOTHROW(datelib::isBusinessDay(std::span<const sys_days>{}, flags, calendar));
+        REQUIRE_NOTHROW(datelib::adjust(std::span<const sys_days>{}, adjusted,
+                                        datelib::BusinessDayConvention::Following, calendar));
+        REQUIRE_THROWS_AS(datelib::isBusinessDay(dates, flags, calendar), std::invalid_argument);
+        REQUIRE_THROWS_AS(datelib::adjust(dates, adjusted,
+                                          datelib::BusinessDayConvention::Following, calendar),
+                          std::invalid_argument);
+    }
+}
+
+TEST_CASE("Batch advance over a tenor grid", "[advance][batch]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    calendar.addRule(std::make_unique<datelib::NthWeekdayRule>("Memorial Day", 5, 1,
+                                                               datelib::Occurrence::Last));
+
+    const std::vector<datelib::Period> grid = {
+        datelib::Period::parse("1D"),  datelib::Period::parse("2D"),
+        datelib::Period::parse("1W"),  datelib::Period::parse("2W"),
+        datelib::Period::parse("1M"),  datelib::Period::parse("3M"),
+        datelib::Period::parse("6M"),  datelib::Period::parse("9M"),
+        datelib::Period::parse("18M"), datelib::Period::parse("1Y"),
+        datelib::Period::parse("5Y"),  datelib::Period::parse("30Y"),
+        datelib::Period::parse("50Y"), datelib::Period::parse("-1D"),
+        datelib::Period::parse("-3M"), datelib::Period::parse("-13M"),
+        datelib::Period::parse("-2Y"), datelib::Period::parse("300D")};
+
+    SECTION("Matches the scalar advance for every pillar") {
+        using enum datelib::BusinessDayConvention;
+        const std::vector<year_month_day> anchors = {
+            2024y / January / 31, 2024y / February / 29, 2023y / December / 29,
+            2024y / May / 31,     2025y / November / 30, 2024y / July / 13};
+        for (const auto& anchor : anchors) {
+            for (const auto convention :
+                 {Following, ModifiedFollowing, Preceding, ModifiedPreceding, Unadjusted}) {
+                const auto pillars = datelib::advance(anchor, grid, convention, calendar);
+                REQUIRE(pillars.size() == grid.size());
+                for (std::size_t i = 0; i < grid.size(); ++i) {
+                    REQUIRE(pillars[i] == datelib::advance(anchor, grid[i], convention, calendar));
+                }
+            }
+        }
+    }
+
+    SECTION("Matches the scalar advance with a custom weekend") {
+        constexpr auto weekend = datelib::WeekendMask::of(Friday, Saturday);
+        const auto pillars = datelib::advance(2024y / March / 31, grid,
+                                              datelib::BusinessDayConvention::Following, calendar,
+                                              weekend);
+        for (std::size_t i = 0; i < grid.size(); ++i) {
+            REQUIRE(pillars[i] == datelib::advance(2024y / March / 31, grid[i],
+                                                   datelib::BusinessDayConvention::Following,
+                                                   calendar, weekend));
+        }
+    }
+
+    SECTION("Empty grids and invalid anchors") {
+        REQUIRE(datelib::advance(2024y / January / 15, std::span<const datelib::Period>{},
+                                 datelib::BusinessDayConvention::Following, calendar)
+                    .empty());
+        REQUIRE_THROWS_AS(datelib::advance(2024y / February / 30, grid,
+                                           datelib::BusinessDayConvention::Following, calendar),
+                          datelib::InvalidDateException);
+    }
+
+    SECTION("A weekend covering every day fails like the scalar advance") {
+        constexpr auto weekend = datelib::WeekendMask::of(Monday, Tuesday, Wednesday, Thursday,
+                                                          Friday, Saturday, Sunday);
+        REQUIRE_THROWS_AS(datelib::advance(2024y / January / 15, grid,
+                                           datelib::BusinessDayConvention::Following, calendar,
+                                           weekend),
+                          datelib::BusinessDaySearchException);
+    }
+}
+
+TEST_CASE("Month arithmetic across year boundaries", "[advance][Period]") {
+    datelib::HolidayCalendar calendar;
+    using enum datelib::BusinessDayConvention;
+
+    REQUIRE(datelib::advance(2024y / January / 31, "-13M", Unadjusted, calendar) ==
+            2022y / December / 31);
+    REQUIRE(datelib::advance(2024y / March / 31, "-1M", Unadjusted, calendar) ==
+            2024y / February / 29);
+    REQUIRE(datelib::advance(2024y / December / 15, "25M", Unadjusted, calendar) ==
+            2027y / January / 15);
+    REQUIRE(datelib::advance(2024y / February / 29, "-4Y", Unadjusted, calendar) ==
+            2020y / February / 29);
+    REQUIRE(datelib::advance(2024y / February / 29, "-1Y", Unadjusted, calendar) ==
+            2023y / February / 28);
+    REQUIRE(datelib::advance(2024y / January / 15, "-24300M", Unadjusted, calendar) ==
+            -1y / January / 15);
+}
+
+TEST_CASE("tryAdjust and tryAdvance", "[adjust][advance][expected]") {
+    using datelib::BusinessDayConvention;
+    using datelib::ErrorCode;
+
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+
+    SECTION("Valid input gives the same dates as the throwing functions") {
+        for (const auto convention :
+             {BusinessDayConvention::Following, BusinessDayConvention::ModifiedFollowing,
+              BusinessDayConvention::Preceding, BusinessDayConvention::ModifiedPreceding,
+              BusinessDayConvention::Unadjusted}) {
+            for (const auto date : {2024y / December / 25, 2024y / March / 30,
+                                    2024y / August / 31, 2025y / January / 1}) {
+                REQUIRE(datelib::tryAdjust(date, convention, calendar) ==
+                        datelib::adjust(date, convention, calendar));
+                for (const auto* period : {"3D", "-2D", "1W", "1M", "2Y"}) {
+                    REQUIRE(datelib::tryAdvance(date, period, convention, calendar) ==
+                            datelib::advance(date, period, convention, calendar));
+                }
+            }
+        }
+    }
+
+    SECTION("Invalid dates are reported") {
+        const auto invalid = 2024y / February / 30;
+        REQUIRE(datelib::tryAdjust(invalid, BusinessDayConvention::Following, calendar)
+                    .error()
+                    .code() == ErrorCode::InvalidDate);
+        REQUIRE(datelib::tryAdvance(invalid, "1M", BusinessDayConvention::Following, calendar)
+                    .error()
+                    .code() == ErrorCode::InvalidDate);
+    }
+
+    SECTION("Invalid period strings are reported") {
+        REQUIRE(datelib::tryAdvance(2024y / January / 15, "1Q", BusinessDayConvention::Following,
+                                    calendar)
+                    .error()
+                    .code() == ErrorCode::InvalidPeriodUnit);
+    }
+
+    SECTION("An unknown convention is reported") {
+        const auto invalid_convention = static_cast<BusinessDayConvention>(999);
+        REQUIRE(datelib::tryAdjust(2024y / January / 6, invalid_convention, calendar)
+                    .error()
+                    .code() == ErrorCode::UnhandledConvention);
+    }
+
+    SECTION("Failed searches are reported") {
+        datelib::HolidayCalendar all_holidays;
+        for (auto date = sys_days{2023y / January / 1}; date <= sys_days{2025y / December / 31};
+             date += days{1}) {
+            all_holidays.addHoliday("Holiday", year_month_day{date});
+        }
+        const auto saturday = 2024y / January / 6;
+
+        REQUIRE(datelib::tryAdjust(saturday, BusinessDayConvention::Following, all_holidays)
+                    .error()
+                    .code() == ErrorCode::NextBusinessDayNotFound);
+        REQUIRE(datelib::tryAdjust(saturday, BusinessDayConvention::Preceding, all_holidays)
+                    .error()
+                    .code() == ErrorCode::PreviousBusinessDayNotFound);
+        REQUIRE(datelib::tryAdvance(saturday, "1D", BusinessDayConvention::Following, all_holidays)
+                    .error()
+                    .code() == ErrorCode::BusinessDaysNotReached);
+    }
+}
@@ -0,0 +1,105 @@
+#include "datelib/HolidayCalendar.h"
+#include "datelib/date.h"
+#include "datelib/stats.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::chrono;
+using datelib::stats::Counter;
+
+namespace {
+class ThrowingRule : public datelib::HolidayRule {
+  public:
+    [[nodiscard]] bool appliesTo(int /*year*/) const override { return true; }
+    [[nodiscard]] year_month_day calculateDate(int /*year*/) const override {
+        throw std::runtime_error("Rule cannot be evaluated");
+    }
+    [[nodiscard]] std::string getName() const override { return "Throwing"; }
+    [[nodiscard]] std::unique_ptr<HolidayRule> clone() const override {
+        return std::make_unique<ThrowingRule>();
+    }
+};
+} // namespace
+
+TEST_CASE("Stats count calendar and search work", "[stats]") {
+    datelib::HolidayCalendar calendar;
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("New Year's Day", 1, 1));
+    calendar.addRule(std::make_unique<datelib::FixedDateRule>("Christmas", 12, 25));
+    datelib::stats::reset();
+
+    SECTION("Calendar lookups") {
+        REQUIRE(calendar.isHoliday(2024y / December / 25));
+        REQUIRE_FALSE(calendar.isHoliday(2024y / December / 24));
+        const auto stats = datelib::stats::snapshot();
+        if constexpr (datelib::stats::ENABLED) {
+            REQUIRE(stats[Counter::IsHolidayCalls] == 2);
+            REQUIRE(stats[Counter::RuleEvaluations] == 2);
+            REQUIRE(stats[Counter::YearCacheMisses] == 1);
+            REQUIRE(stats[Counter::YearCacheHits] == 1);
+        } else {
+            REQUIRE(stats[Counter::IsHolidayCalls] == 0);
+            REQUIRE(stats[Counter::RuleEvaluations] == 0);
+        }
+    }
+
+    SECTION("Business day searches") {
+        // Wednesday, December 25, 2024 forward to Thursday; Saturday, December 28 back to Friday
+        (void)datelib::adjust(2024y / December / 25, datelib::BusinessDayConvention::Following,
+                              calendar);
+        (void)datelib::adjust(2024y / December / 28, datelib::BusinessDayConvention::Preceding,
+                              calendar);
+        // Friday, December 20, 2024 + 5 business days walks 10 calendar days to the 30th
+        (void)datelib::advance(2024y / December / 20, "5D",
+                               datelib::BusinessDayConvention::Following, calendar);
+        const auto stats = datelib::stats::snapshot();
+        const std::uint64_t expected = datelib::stats::ENABLED ? 1 : 0;
+        REQUIRE(stats[Counter::NextBusinessDaySteps] == expected);
+        REQUIRE(stats[Counter::PreviousBusinessDaySteps] == expected);
+        REQUIRE(stats[Counter::AddBusinessDaysSteps] == 10 * expected);
+    }
+
+    SECTION("Exceptions from rules") {
+        datelib::HolidayCalendar failing;
+        failing.addRule(std::make_unique<ThrowingRule>());
+        REQUIRE_THROWS_AS(failing.isHoliday(2024y / January / 1), std::runtime_error);
+        REQUIRE(datelib::stats::snapshot()[Counter::RuleExceptions] ==
+                (datelib::stats::ENABLED ? 1U : 0U));
+    }
+
+    SECTION("Threads are added up, also after they exit") {
+        std::thread worker([&calendar] {
+            for (int i = 0; i < 100; ++i) {
+                (void)calendar.isHoliday(2025y / January / 1);
+            }
+        });
+        worker.join();
+        (void)calendar.isHoliday(2025y / January / 2);
+        REQUIRE(datelib::stats::snapshot()[Counter::IsHolidayCalls] ==
+                (datelib::stats::ENABLED ? 101U : 0U));
+    }
+
+    SECTION("Reset starts from zero") {
+        (void)calendar.isHoliday(2024y / December / 25);
+        datelib::stats::reset();
+        REQUIRE(datelib::stats::snapshot()[Counter::IsHolidayCalls] == 0);
+    }
+}
+
+TEST_CASE("Stats Prometheus export", "[stats]") {
+    const std::string text = datelib::stats::snapshot().toPrometheus();
+
+    REQUIRE(datelib::stats::metricName(Counter::IsHolidayCalls) ==
+            "datelib_is_holiday_calls_total");
+    REQUIRE(text.starts_with("# HELP datelib_is_holiday_calls_total "));
+    REQUIRE(text.find("# TYPE datelib_is_holiday_calls_total counter\n") != std::string::npos);
+    for (std::size_t i = 0; i < datelib::stats::COUNTER_COUNT; ++i) {
+        const std::string name{datelib::stats::metricName(static_cast<Counter>(i))};
+        REQUIRE(text.find("\n" + name + " ") != std::string::npos);
+    }
+    REQUIRE(text.ends_with("\n"));
+}